@@ -221,6 +221,19 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				index++;
 				String str;
 				while (true) {
+					// Append runs of plain characters at once, so that strings without escapes
+					// are built with a single allocation.
+					const int run_start = index;
+					while (p_str[index] != 0 && p_str[index] != '"' && p_str[index] != '\\') {
+						if (p_str[index] == '\n') {
+							line++;
+						}
+						index++;
+					}
+					if (index > run_start) {
+						str.append_utf32(Span(&p_str[run_start], index - run_start));
+					}
+
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
@@ -343,14 +356,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
-
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+						index++;
 					}
-					index++;
 				}
 
 				r_token.type = TK_STRING;
@@ -374,13 +381,14 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if (is_ascii_alphabet_char(p_str[index])) {
-					String id;
-
+					const int id_start = index;
 					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
+					String id;
+					id.append_utf32(Span(&p_str[id_start], index - id_start));
+
 					r_token.type = TK_IDENTIFIER;
 					r_token.value = id;
 					return OK;
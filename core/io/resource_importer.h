@@ -155,6 +155,12 @@ public:
 
 	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) = 0;
 	virtual bool can_import_threaded() const { return false; }
+	// True if import() reads nothing but the source file, its options and the settings reported by
+	// get_import_cache_settings_string(), and writes nothing outside the save path. This allows the
+	// editor to restore the result from its shared import cache.
+	virtual bool is_import_self_contained() const { return false; }
+	// Values of the project and editor settings that import() reads with the given options.
+	virtual String get_import_cache_settings_string(const HashMap<StringName, Variant> &p_options) const { return String(); }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
 
@@ -36,18 +36,16 @@
 
 Error StreamPeerTCP::poll() {
 	if (status == STATUS_CONNECTED) {
-		Error err;
-		err = _sock->poll(NetSocket::POLL_TYPE_IN, 0);
+		// A single poll is enough, socket errors are reported regardless of the requested events.
+		Error err = _sock->poll(NetSocket::POLL_TYPE_IN, 0);
 		if (err == OK) {
 			// FIN received
 			if (_sock->get_available_bytes() == 0) {
 				disconnect_from_host();
-				return OK;
 			}
+			return OK;
 		}
-		// Also poll write
-		err = _sock->poll(NetSocket::POLL_TYPE_IN_OUT, 0);
-		if (err != OK && err != ERR_BUSY) {
+		if (err != ERR_BUSY) {
 			// Got an error
 			disconnect_from_host();
 			status = STATUS_ERROR;
@@ -245,52 +245,57 @@ Error CallQueue::flush() {
 	uint32_t offset = 0;
 
 	while (i < pages_used && offset < page_bytes[i]) {
+		// Everything up to the current end of the page is fully written and pages never move,
+		// so process it without holding the lock. This avoids bouncing the mutex with threads
+		// pushing deferred calls for every single message; anything they push meanwhile
+		// (or a call re-adding itself) is picked up once the lock is taken again below.
 		Page *page = pages[i];
+		const uint32_t page_end = page_bytes[i];
 
-		//lock on each iteration, so a call can re-add itself to the message queue
+		UNLOCK_MUTEX;
 
-		Message *message = (Message *)&page->data[offset];
+		while (offset < page_end) {
+			Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
+			uint32_t advance = sizeof(Message);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				advance += sizeof(Variant) * message->args;
+			}
 
-		//pre-advance so this function is reentrant
-		offset += advance;
+			//pre-advance so this function is reentrant
+			offset += advance;
 
-		Object *target = message->callable.get_object();
+			Object *target = message->callable.get_object();
 
-		UNLOCK_MUTEX;
+			switch (message->type & FLAG_MASK) {
+				case TYPE_CALL: {
+					if (target || (message->type & FLAG_NULL_IS_OK)) {
+						Variant *args = (Variant *)(message + 1);
+						_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
+					}
+				} break;
+				case TYPE_NOTIFICATION: {
+					if (target) {
+						target->notification(message->notification);
+					}
+				} break;
+				case TYPE_SET: {
+					if (target) {
+						Variant *arg = (Variant *)(message + 1);
+						target->set(message->callable.get_method(), *arg);
+					}
+				} break;
+			}
 
-		switch (message->type & FLAG_MASK) {
-			case TYPE_CALL: {
-				if (target || (message->type & FLAG_NULL_IS_OK)) {
-					Variant *args = (Variant *)(message + 1);
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
-				}
-			} break;
-			case TYPE_NOTIFICATION: {
-				if (target) {
-					target->notification(message->notification);
-				}
-			} break;
-			case TYPE_SET: {
-				if (target) {
-					Variant *arg = (Variant *)(message + 1);
-					target->set(message->callable.get_method(), *arg);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				Variant *args = (Variant *)(message + 1);
+				for (int k = 0; k < message->args; k++) {
+					args[k].~Variant();
 				}
-			} break;
-		}
-
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
 			}
-		}
 
-		message->~Message();
+			message->~Message();
+		}
 
 		LOCK_MUTEX;
 		if (offset == page_bytes[i]) {
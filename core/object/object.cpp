@@ -1232,6 +1232,11 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			return ERR_UNAVAILABLE;
 		}
 
+		if (s->slot_map.is_empty()) {
+			// Declared or previously connected, but nothing to call; skip the snapshot entirely.
+			return OK;
+		}
+
 		// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 		// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 		Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
@@ -1241,16 +1246,18 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
 		slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
 
+		bool has_one_shot = false;
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
 			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
 			slot_flags[slot_count] = slot_kv.value.conn.flags;
+			has_one_shot = has_one_shot || (slot_kv.value.conn.flags & CONNECT_ONE_SHOT);
 			++slot_count;
 		}
 
 		DEV_ASSERT(slot_count == s->slot_map.size());
 
 		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
+		for (uint32_t i = 0; has_one_shot && i < slot_count; ++i) {
 			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
 			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
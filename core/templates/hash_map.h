@@ -235,6 +235,14 @@ private:
 		return elem;
 	}
 
+	// Keys coming from another map are known to be unique, so skip the lookup done by insert().
+	// Assumes this map is empty and already has at least the capacity of p_other.
+	void _copy_elements_from(const HashMap &p_other) {
+		for (const HashMapElement<TKey, TValue> *E = p_other.head_element; E; E = E->next) {
+			_insert(E->data.key, E->data.value, _hash(E->data.key));
+		}
+	}
+
 public:
 	_FORCE_INLINE_ uint32_t get_capacity() const { return hash_table_size_primes[capacity_index]; }
 	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
@@ -584,9 +592,7 @@ public:
 			return;
 		}
 
-		for (const KeyValue<TKey, TValue> &E : p_other) {
-			insert(E.key, E.value);
-		}
+		_copy_elements_from(p_other);
 	}
 
 	void operator=(const HashMap &p_other) {
@@ -603,9 +609,7 @@ public:
 			return; // Nothing to copy.
 		}
 
-		for (const KeyValue<TKey, TValue> &E : p_other) {
-			insert(E.key, E.value);
-		}
+		_copy_elements_from(p_other);
 	}
 
 	HashMap(uint32_t p_initial_capacity) {
@@ -622,9 +622,8 @@ Dictionary Dictionary::recursive_duplicate(bool p_deep, ResourceDeepDuplicateMod
 			Resource::_teardown_duplicate_from_variant();
 		}
 	} else {
-		for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-			n[E.key] = E.value;
-		}
+		// Same keys and values, so they need no validation and the map can be copied as is.
+		n._p->variant_map = _p->variant_map;
 	}
 
 	return n;
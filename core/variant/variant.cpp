@@ -36,6 +36,7 @@
 #include "core/io/json.h"
 #include "core/io/resource.h"
 #include "core/math/math_funcs.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small;
@@ -2093,7 +2094,13 @@ template <typename DA>
 inline DA _convert_array_from_variant(const Variant &p_variant) {
 	switch (p_variant.get_type()) {
 		case Variant::ARRAY: {
-			return _convert_array<DA, Array>(p_variant.operator Array());
+			if constexpr (std::is_same_v<DA, Array>) {
+				return _convert_array<DA, Array>(p_variant.operator Array());
+			} else {
+				DA da;
+				VariantPackedArrayFromArray::convert(*VariantInternal::get_array(&p_variant), da);
+				return da;
+			}
 		}
 		case Variant::PACKED_BYTE_ARRAY: {
 			return _convert_array<DA, PackedByteArray>(p_variant.operator PackedByteArray());
@@ -3392,7 +3399,7 @@ bool Variant::identity_compare(const Variant &p_variant) const {
 	}
 }
 
-bool StringLikeVariantComparator::compare(const Variant &p_lhs, const Variant &p_rhs) {
+bool StringLikeVariantComparator::_compare(const Variant &p_lhs, const Variant &p_rhs) {
 	if (p_lhs.hash_compare(p_rhs)) {
 		return true;
 	}
@@ -175,6 +175,8 @@ private:
 
 	friend struct _VariantCall;
 	friend class VariantInternal;
+	friend struct VariantHasher;
+	friend struct StringLikeVariantComparator;
 	// Variant takes 24 bytes when real_t is float, and 40 bytes if double.
 	// It only allocates extra memory for AABB/Transform2D (24, 48 if double),
 	// Basis/Transform3D (48, 96 if double), Projection (64, 128 if double),
@@ -897,7 +899,13 @@ Vector<Variant> varray(VarArgs... p_args) {
 }
 
 struct VariantHasher {
-	static _FORCE_INLINE_ uint32_t hash(const Variant &p_variant) { return p_variant.hash(); }
+	static _FORCE_INLINE_ uint32_t hash(const Variant &p_variant) {
+		// StringName keys (the common case for data-driven dictionaries) have their hash cached.
+		if (p_variant.type == Variant::STRING_NAME) {
+			return reinterpret_cast<const StringName *>(p_variant._data._mem)->hash();
+		}
+		return p_variant.hash();
+	}
 };
 
 struct VariantComparator {
@@ -905,7 +913,15 @@ struct VariantComparator {
 };
 
 struct StringLikeVariantComparator {
-	static bool compare(const Variant &p_lhs, const Variant &p_rhs);
+	static _FORCE_INLINE_ bool compare(const Variant &p_lhs, const Variant &p_rhs) {
+		if (p_lhs.type == Variant::STRING_NAME && p_rhs.type == Variant::STRING_NAME) {
+			return *reinterpret_cast<const StringName *>(p_lhs._data._mem) == *reinterpret_cast<const StringName *>(p_rhs._data._mem);
+		}
+		return _compare(p_lhs, p_rhs);
+	}
+
+private:
+	static bool _compare(const Variant &p_lhs, const Variant &p_rhs);
 };
 
 struct StringLikeVariantOrder {
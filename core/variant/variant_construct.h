@@ -655,11 +655,7 @@ public:
 		const Array &src_arr = *VariantGetInternalPtr<Array>::get_ptr(p_args[0]);
 		T &dst_arr = *VariantGetInternalPtr<T>::get_ptr(&r_ret);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		VariantPackedArrayFromArray::convert(src_arr, dst_arr);
 	}
 
 	static inline void validated_construct(Variant *r_ret, const Variant **p_args) {
@@ -667,21 +663,13 @@ public:
 		const Array &src_arr = *VariantGetInternalPtr<Array>::get_ptr(p_args[0]);
 		T &dst_arr = *VariantGetInternalPtr<T>::get_ptr(r_ret);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		VariantPackedArrayFromArray::convert(src_arr, dst_arr);
 	}
 	static void ptr_construct(void *base, const void **p_args) {
 		Array src_arr = PtrToArg<Array>::convert(p_args[0]);
 		T dst_arr;
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		VariantPackedArrayFromArray::convert(src_arr, dst_arr);
 
 		PtrConstruct<T>::construct(dst_arr, base);
 	}
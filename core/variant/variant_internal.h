@@ -1450,3 +1450,31 @@ struct VariantTypeConstructor {
 		memnew_placement(r_value, T(*reinterpret_cast<Variant *>(p_variant)));
 	}
 };
+
+// Packed array helpers.
+
+struct VariantPackedArrayFromArray {
+	// Elements already holding the packed element type are read directly from
+	// their payload, skipping the generic Variant conversion. This is the case for
+	// every element of a typed array of the matching builtin type.
+	template <typename T>
+	static void convert(const Array &p_src, Vector<T> &r_dst) {
+		constexpr Variant::Type element_type = GetTypeInfo<T>::VARIANT_TYPE;
+
+		const int size = p_src.size();
+		r_dst.resize(size);
+		if (size == 0) {
+			return;
+		}
+
+		T *dst = r_dst.ptrw();
+		for (const Variant &element : p_src) {
+			if (likely(element.get_type() == element_type)) {
+				*dst = VariantInternalAccessor<T>::get(&element);
+			} else {
+				*dst = element;
+			}
+			dst++;
+		}
+	}
+};
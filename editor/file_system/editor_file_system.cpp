@@ -42,6 +42,7 @@
 #include "core/variant/variant_parser.h"
 #include "editor/doc/editor_help.h"
 #include "editor/editor_node.h"
+#include "editor/file_system/editor_import_cache.h"
 #include "editor/file_system/editor_paths.h"
 #include "editor/inspector/editor_resource_preview.h"
 #include "editor/script/script_editor_plugin.h"
@@ -572,7 +573,7 @@ bool EditorFileSystem::_is_test_for_reimport_needed(const String &p_path, uint64
 	return false;
 }
 
-bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_expected_import_md5) {
+bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_expected_import_md5, ImportMD5Check *r_md5_check) {
 	if (p_expected_import_md5.is_empty()) {
 		// Marked as reimportation needed.
 		return true;
@@ -726,6 +727,14 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 		return true; // Lacks md5, so just reimport.
 	}
 
+	if (r_md5_check) {
+		// Let the caller hash the files, see _check_import_md5().
+		r_md5_check->source_md5 = source_md5;
+		r_md5_check->dest_files = dest_files;
+		r_md5_check->dest_md5 = dest_md5;
+		return false;
+	}
+
 	String md5 = FileAccess::get_md5(p_path);
 	if (md5 != source_md5) {
 		return true;
@@ -741,6 +750,62 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 	return false; // Nothing changed.
 }
 
+void EditorFileSystem::_check_import_md5(uint32_t p_index, ImportMD5Check *p_checks) {
+	ImportMD5Check &check = p_checks[p_index];
+	if (FileAccess::get_md5(check.path) != check.source_md5) {
+		check.need_reimport = true;
+	} else if (!check.dest_files.is_empty() && !check.dest_md5.is_empty()) {
+		check.need_reimport = FileAccess::get_multiple_md5(check.dest_files) != check.dest_md5;
+	}
+}
+
+void EditorFileSystem::_run_import_md5_checks(LocalVector<ImportMD5Check> &r_checks, Vector<String> &r_reimports, EditorProgress *p_progress, int &r_step) {
+	if (r_checks.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_check_import_md5, r_checks.ptr(), r_checks.size(), -1, true, "EditorFileSystemCheckImportMD5");
+	if (p_progress) {
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			p_progress->step(TTR("Checking imported files..."), r_step + WorkerThreadPool::get_singleton()->get_group_processed_element_count(group_task), false);
+			OS::get_singleton()->delay_usec(10000);
+		}
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	r_step += r_checks.size();
+
+	for (const ImportMD5Check &check : r_checks) {
+		int idx = check.dir->find_file_index(check.file);
+		ERR_CONTINUE(idx == -1);
+		_apply_reimport_test(check.dir, idx, check.need_reimport, r_reimports);
+	}
+	r_checks.clear();
+}
+
+void EditorFileSystem::_apply_reimport_test(EditorFileSystemDirectory *p_dir, int p_idx, bool p_need_reimport, Vector<String> &r_reimports) {
+	String full_path = p_dir->get_file_path(p_idx);
+	if (p_need_reimport) {
+		// Must reimport.
+		r_reimports.push_back(full_path);
+		Vector<String> dependencies = _get_dependencies(full_path);
+		for (const String &dep : dependencies) {
+			const String &dependency_path = dep.contains("::") ? dep.get_slice("::", 0) : dep;
+			if (_can_import_file(dep)) {
+				r_reimports.push_back(dependency_path);
+			}
+		}
+	} else {
+		// Must not reimport, all was good.
+		// Update modified times, md5 and destination paths, to avoid reimport.
+		p_dir->files[p_idx]->modified_time = FileAccess::get_modified_time(full_path);
+		p_dir->files[p_idx]->import_modified_time = FileAccess::get_modified_time(full_path + ".import");
+		if (p_dir->files[p_idx]->import_md5.is_empty()) {
+			p_dir->files[p_idx]->import_md5 = FileAccess::get_md5(full_path + ".import");
+		}
+		p_dir->files[p_idx]->import_dest_paths = _get_import_dest_paths(full_path);
+	}
+}
+
 Vector<String> EditorFileSystem::_get_import_dest_paths(const String &p_path) {
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path + ".import", FileAccess::READ, &err);
@@ -853,14 +918,27 @@ bool EditorFileSystem::_update_scan_actions() {
 
 	Vector<String> reimports;
 	Vector<String> reloads;
+	LocalVector<ImportMD5Check> md5_checks;
 
 	EditorProgress *ep = nullptr;
 	if (scan_actions.size() > 1) {
-		ep = memnew(EditorProgress("_update_scan_actions", TTR("Scanning actions..."), scan_actions.size()));
+		// Reimport tests take a second step for hashing the files.
+		int step_total = scan_actions.size();
+		for (const ItemAction &ia : scan_actions) {
+			if (ia.action == ItemAction::ACTION_FILE_TEST_REIMPORT) {
+				step_total++;
+			}
+		}
+		ep = memnew(EditorProgress("_update_scan_actions", TTR("Scanning actions..."), step_total));
 	}
 
 	int step_count = 0;
 	for (const ItemAction &ia : scan_actions) {
+		if (ia.action == ItemAction::ACTION_DIR_REMOVE || ia.action == ItemAction::ACTION_FILE_REMOVE) {
+			// Pending checks point to directories and files this action may delete.
+			_run_import_md5_checks(md5_checks, reimports, ep, step_count);
+		}
+
 		switch (ia.action) {
 			case ItemAction::ACTION_NONE: {
 			} break;
@@ -965,26 +1043,17 @@ bool EditorFileSystem::_update_scan_actions() {
 				ERR_CONTINUE(idx == -1);
 				String full_path = ia.dir->get_file_path(idx);
 
-				bool need_reimport = _test_for_reimport(full_path, ia.dir->files[idx]->import_md5);
-				if (need_reimport) {
-					// Must reimport.
-					reimports.push_back(full_path);
-					Vector<String> dependencies = _get_dependencies(full_path);
-					for (const String &dep : dependencies) {
-						const String &dependency_path = dep.contains("::") ? dep.get_slice("::", 0) : dep;
-						if (_can_import_file(dep)) {
-							reimports.push_back(dependency_path);
-						}
-					}
+				ImportMD5Check md5_check;
+				bool need_reimport = _test_for_reimport(full_path, ia.dir->files[idx]->import_md5, &md5_check);
+				if (!need_reimport && !md5_check.source_md5.is_empty()) {
+					// Only the hashes are left to compare, they are batched, see _run_import_md5_checks().
+					md5_check.dir = ia.dir;
+					md5_check.file = ia.file;
+					md5_check.path = full_path;
+					md5_checks.push_back(md5_check);
 				} else {
-					// Must not reimport, all was good.
-					// Update modified times, md5 and destination paths, to avoid reimport.
-					ia.dir->files[idx]->modified_time = FileAccess::get_modified_time(full_path);
-					ia.dir->files[idx]->import_modified_time = FileAccess::get_modified_time(full_path + ".import");
-					if (ia.dir->files[idx]->import_md5.is_empty()) {
-						ia.dir->files[idx]->import_md5 = FileAccess::get_md5(full_path + ".import");
-					}
-					ia.dir->files[idx]->import_dest_paths = _get_import_dest_paths(full_path);
+					_apply_reimport_test(ia.dir, idx, need_reimport, reimports);
+					step_count++; // Skip the hashing step of this file.
 				}
 
 				fs_changed = true;
@@ -1005,6 +1074,8 @@ bool EditorFileSystem::_update_scan_actions() {
 		}
 	}
 
+	_run_import_md5_checks(md5_checks, reimports, ep, step_count);
+
 	memdelete_notnull(ep);
 
 	if (_scan_extensions()) {
@@ -2895,7 +2966,26 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err;
+
+	String import_cache_entry = EditorImportCache::get_entry_path(EDITOR_GET("filesystem/import/shared_cache_path"), p_file, uid, importer, opts, params, generator_parameters);
+	if (!import_cache_entry.is_empty() && EditorImportCache::load_entry(import_cache_entry, base_path, import_variants, meta) && importer->are_import_settings_valid(p_file, meta)) {
+		import_cache_hits.increment();
+		err = OK;
+	} else {
+		import_variants.clear();
+		meta = Variant();
+		uint64_t import_time = (uint64_t)OS::get_singleton()->get_unix_time();
+		err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		if (!import_cache_entry.is_empty()) {
+			import_cache_misses.increment();
+			// Files generated next to the source can't be restored from the cache, so these imports always run.
+			if (err == OK && gen_files.is_empty()) {
+				EditorImportCache::save_entry(import_cache_entry, base_path, import_time, import_variants, meta);
+			}
+		}
+	}
 
 	// As import is complete, save the .import file.
 
@@ -3200,6 +3290,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	HashSet<String> groups_to_reimport;
 
+	import_cache_hits.set(0);
+	import_cache_misses.set(0);
+
 	for (int i = 0; i < p_files.size(); i++) {
 		ep->step(TTR("Preparing files to reimport..."), i, false);
 
@@ -3337,6 +3430,10 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	}
 	ep->step(TTR("Finalizing Asset Import..."), p_files.size());
 
+	if (import_cache_hits.get() || import_cache_misses.get()) {
+		print_verbose(vformat("EditorFileSystem: Shared import cache: %d hits, %d misses.", import_cache_hits.get(), import_cache_misses.get()));
+	}
+
 	ResourceUID::get_singleton()->update_cache(); // After reimporting, update the cache.
 	_save_filesystem_cache();
 
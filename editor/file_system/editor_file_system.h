@@ -43,6 +43,7 @@
 
 class FileAccess;
 
+struct EditorProgress;
 struct EditorProgressBG;
 class EditorFileSystemDirectory : public Object {
 	GDCLASS(EditorFileSystemDirectory, Object);
@@ -279,7 +280,25 @@ class EditorFileSystem : public Node {
 	Error _reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options = HashMap<StringName, Variant>(), const String &p_custom_importer = String(), Variant *generator_parameters = nullptr, bool p_update_file_system = true);
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
-	bool _test_for_reimport(const String &p_path, const String &p_expected_import_md5);
+	SafeNumeric<uint32_t> import_cache_hits;
+	SafeNumeric<uint32_t> import_cache_misses;
+
+	// Source and imported files hashing, the slowest part of the reimport test, done on worker threads.
+	// Pending checks are run before any scan action removes files or directories, so dir stays valid.
+	struct ImportMD5Check {
+		EditorFileSystemDirectory *dir = nullptr;
+		String file;
+		String path;
+		String source_md5;
+		Vector<String> dest_files;
+		String dest_md5;
+		bool need_reimport = false;
+	};
+
+	bool _test_for_reimport(const String &p_path, const String &p_expected_import_md5, ImportMD5Check *r_md5_check);
+	void _check_import_md5(uint32_t p_index, ImportMD5Check *p_checks);
+	void _run_import_md5_checks(LocalVector<ImportMD5Check> &r_checks, Vector<String> &r_reimports, EditorProgress *p_progress, int &r_step);
+	void _apply_reimport_test(EditorFileSystemDirectory *p_dir, int p_idx, bool p_need_reimport, Vector<String> &r_reimports);
 	bool _is_test_for_reimport_needed(const String &p_path, uint64_t p_last_modification_time, uint64_t p_modification_time, uint64_t p_last_import_modification_time, uint64_t p_import_modification_time, const Vector<String> &p_import_dest_paths);
 	bool _can_import_file(const String &p_path);
 	Vector<String> _get_import_dest_paths(const String &p_path);
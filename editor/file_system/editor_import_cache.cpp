@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*  editor_import_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_import_cache.h"
+
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+#include "core/version.h"
+
+String EditorImportCache::get_entry_path(const String &p_cache_path, const String &p_file, ResourceUID::ID p_uid, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params, const Variant &p_generator_parameters) {
+	if (p_cache_path.is_empty() || p_importer->get_save_extension().is_empty() || !p_importer->is_import_self_contained()) {
+		return String();
+	}
+
+	// Besides the source and its options, self-contained importers only read the settings they report.
+	// The path and UID are included as they can be embedded in the imported files, and the engine build
+	// as codecs can change without the importer's format version being bumped.
+	String key = String(REDOT_VERSION_FULL_BUILD) + "\n" + String(REDOT_VERSION_HASH) + "\n";
+	key += p_file + "\n" + ResourceUID::get_singleton()->id_to_text(p_uid) + "\n" + FileAccess::get_md5(p_file) + "\n";
+	key += p_importer->get_importer_name() + "\n" + itos(p_importer->get_format_version()) + "\n";
+	key += p_importer->get_import_cache_settings_string(p_params) + "\n";
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += String(E.option.name) + "=" + value + "\n";
+	}
+	if (p_generator_parameters != Variant()) {
+		key += p_generator_parameters.get_construct_string();
+	}
+
+	String md5 = key.md5_text();
+	return p_cache_path.path_join(md5.substr(0, 2)).path_join(md5);
+}
+
+bool EditorImportCache::load_entry(const String &p_entry_path, const String &p_base_path, List<String> &r_variants, Variant &r_metadata) {
+	// Entries are renamed into place once complete, so a readable manifest means all the files are there.
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(p_entry_path.path_join("manifest.cfg")) != OK) {
+		return false;
+	}
+
+	Vector<String> files = manifest->get_value("import", "files", Vector<String>());
+	if (files.is_empty()) {
+		return false;
+	}
+	for (const String &E : files) {
+		if (DirAccess::copy_absolute(p_entry_path.path_join("import" + E), p_base_path + E) != OK) {
+			return false;
+		}
+	}
+
+	Vector<String> variants = manifest->get_value("import", "variants", Vector<String>());
+	for (const String &E : variants) {
+		r_variants.push_back(E);
+	}
+	r_metadata = manifest->get_value("import", "metadata", Variant());
+	return true;
+}
+
+Error EditorImportCache::save_entry(const String &p_entry_path, const String &p_base_path, uint64_t p_import_time, const List<String> &p_variants, const Variant &p_metadata) {
+	// Everything the importer wrote starts with the save path, this includes side files
+	// that aren't reported as variants (e.g. the editor copy of a texture).
+	const String import_dir = p_base_path.get_base_dir();
+	const String prefix = p_base_path.get_file() + ".";
+	Vector<String> files;
+	for (const String &E : DirAccess::get_files_at(import_dir)) {
+		if (!E.begins_with(prefix) || E == prefix + "md5") {
+			continue;
+		}
+		// Skip leftovers of previous imports with different options.
+		if (FileAccess::get_modified_time(import_dir.path_join(E)) < p_import_time) {
+			continue;
+		}
+		files.push_back(E.substr(prefix.length() - 1)); // Keep the leading dot.
+	}
+	ERR_FAIL_COND_V_MSG(files.is_empty(), ERR_FILE_NOT_FOUND, vformat("No imported files found for '%s'.", p_base_path));
+
+	// The cache can be shared by several editors, so build the entry under a unique
+	// name and rename it into place only once it is complete.
+	const String temp_path = p_entry_path + vformat(".%d_%d.tmp", OS::get_singleton()->get_process_id(), (int64_t)Thread::get_caller_id());
+	Error err = DirAccess::make_dir_recursive_absolute(temp_path);
+	ERR_FAIL_COND_V_MSG(err != OK && err != ERR_ALREADY_EXISTS, err, vformat("Cannot create import cache directory '%s'.", temp_path));
+
+	for (const String &E : files) {
+		err = DirAccess::copy_absolute(p_base_path + E, temp_path.path_join("import" + E));
+		if (err != OK) {
+			_remove_entry_dir(temp_path);
+			ERR_FAIL_V_MSG(err, vformat("Cannot store '%s' in the import cache.", p_base_path + E));
+		}
+	}
+
+	Vector<String> variants;
+	for (const String &E : p_variants) {
+		variants.push_back(E);
+	}
+
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	manifest->set_value("import", "files", files);
+	manifest->set_value("import", "variants", variants);
+	if (p_metadata != Variant()) {
+		manifest->set_value("import", "metadata", p_metadata);
+	}
+	err = manifest->save(temp_path.path_join("manifest.cfg"));
+	if (err != OK) {
+		_remove_entry_dir(temp_path);
+		ERR_FAIL_V_MSG(err, vformat("Cannot write import cache manifest in '%s'.", temp_path));
+	}
+
+	err = DirAccess::rename_absolute(temp_path, p_entry_path);
+	if (err != OK) {
+		// Another editor may have stored the same entry in the meantime, keep theirs.
+		_remove_entry_dir(temp_path);
+		return DirAccess::dir_exists_absolute(p_entry_path) ? OK : err;
+	}
+	return OK;
+}
+
+void EditorImportCache::_remove_entry_dir(const String &p_dir) {
+	Ref<DirAccess> da = DirAccess::open(p_dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+	DirAccess::remove_absolute(p_dir);
+}
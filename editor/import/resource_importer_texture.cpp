@@ -1029,6 +1029,37 @@ String ResourceImporterTexture::get_import_settings_string() const {
 	return s;
 }
 
+String ResourceImporterTexture::get_import_cache_settings_string(const HashMap<StringName, Variant> &p_options) const {
+	// Project settings read while compressing, directly or by the image codecs.
+	static const char *project_settings[] = {
+		"rendering/textures/lossless_compression/force_png",
+		"rendering/textures/webp_compression/compression_method",
+		"rendering/textures/webp_compression/lossless_compression_factor",
+		"rendering/textures/vram_compression/compress_with_gpu",
+		"rendering/textures/basis_universal/rdo_dict_size",
+		"rendering/textures/basis_universal/zstd_supercompression",
+		"rendering/textures/basis_universal/zstd_supercompression_level",
+		nullptr
+	};
+
+	String s;
+	for (int i = 0; project_settings[i]; i++) {
+		s += String(project_settings[i]) + "=" + String(ProjectSettings::get_singleton()->get_setting(project_settings[i])) + "\n";
+	}
+	// The imported VRAM formats also depend on the host when they aren't forced by the project.
+	s += "s3tc_bptc=" + itos(ResourceImporterTextureSettings::should_import_s3tc_bptc()) + "\n";
+	s += "etc2_astc=" + itos(ResourceImporterTextureSettings::should_import_etc2_astc()) + "\n";
+
+	if (p_options.has("editor/scale_with_editor_scale") && p_options["editor/scale_with_editor_scale"]) {
+		s += "editor_scale=" + rtos(EDSCALE) + "\n";
+	}
+	if (p_options.has("editor/convert_colors_with_editor_theme") && p_options["editor/convert_colors_with_editor_theme"]) {
+		s += "icon_saturation=" + rtos(EDITOR_GET("interface/theme/icon_saturation")) + "\n";
+		s += "dark_theme=" + itos(EditorThemeManager::is_dark_theme()) + "\n";
+	}
+	return s;
+}
+
 bool ResourceImporterTexture::are_import_settings_valid(const String &p_path, const Dictionary &p_meta) const {
 	if (p_meta.has("has_editor_variant")) {
 		String imported_path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(p_path);
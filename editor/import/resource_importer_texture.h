@@ -121,6 +121,8 @@ public:
 	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override;
 
 	virtual bool can_import_threaded() const override { return true; }
+	virtual bool is_import_self_contained() const override { return true; }
+	virtual String get_import_cache_settings_string(const HashMap<StringName, Variant> &p_options) const override;
 
 	void update_imports();
 
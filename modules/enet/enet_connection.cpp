@@ -146,7 +146,6 @@ ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event,
 		case ENET_EVENT_TYPE_RECEIVE: {
 			// Packet received.
 			if (p_event.peer->data != nullptr) {
-				Ref<ENetPacketPeer> pp = Ref<ENetPacketPeer>((ENetPacketPeer *)p_event.peer->data);
 				r_event.peer = Ref<ENetPacketPeer>((ENetPacketPeer *)p_event.peer->data);
 				r_event.channel_id = p_event.channelID;
 				r_event.packet = p_event.packet;
@@ -38,21 +38,21 @@ void ENetMultiplayerPeer::set_target_peer(int p_peer) {
 
 int ENetMultiplayerPeer::get_packet_peer() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), 1, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.is_empty(), 1);
+	ERR_FAIL_COND_V(_get_incoming_count() == 0, 1);
 
-	return incoming_packets.front()->get().from;
+	return incoming_packets[incoming_packets_read].from;
 }
 
 MultiplayerPeer::TransferMode ENetMultiplayerPeer::get_packet_mode() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), TRANSFER_MODE_RELIABLE, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.is_empty(), TRANSFER_MODE_RELIABLE);
-	return incoming_packets.front()->get().transfer_mode;
+	ERR_FAIL_COND_V(_get_incoming_count() == 0, TRANSFER_MODE_RELIABLE);
+	return incoming_packets[incoming_packets_read].transfer_mode;
 }
 
 int ENetMultiplayerPeer::get_packet_channel() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), 1, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.is_empty(), 1);
-	int ch = incoming_packets.front()->get().channel;
+	ERR_FAIL_COND_V(_get_incoming_count() == 0, 1);
+	int ch = incoming_packets[incoming_packets_read].channel;
 	if (ch >= SYSCH_MAX) { // First 2 channels are reserved.
 		return ch - SYSCH_MAX + 1;
 	}
@@ -142,6 +142,15 @@ void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event
 		packet.transfer_mode = TRANSFER_MODE_UNRELIABLE_ORDERED;
 	}
 	packet.packet->referenceCount++;
+	if (incoming_packets_read > 0 && incoming_packets_read >= incoming_packets.size() / 2) {
+		// Drop the consumed packets so the queue doesn't grow if it's never fully drained.
+		const uint32_t count = _get_incoming_count();
+		for (uint32_t i = 0; i < count; i++) {
+			incoming_packets[i] = incoming_packets[incoming_packets_read + i];
+		}
+		incoming_packets.resize(count);
+		incoming_packets_read = 0;
+	}
 	incoming_packets.push_back(packet);
 }
 
@@ -307,7 +316,12 @@ void ENetMultiplayerPeer::close() {
 	}
 
 	active_mode = MODE_NONE;
+	for (uint32_t i = incoming_packets_read; i < incoming_packets.size(); i++) {
+		incoming_packets[i].packet->referenceCount--;
+		_destroy_unused(incoming_packets[i].packet);
+	}
 	incoming_packets.clear();
+	incoming_packets_read = 0;
 	peers.clear();
 	hosts.clear();
 	unique_id = 0;
@@ -316,16 +330,20 @@ void ENetMultiplayerPeer::close() {
 }
 
 int ENetMultiplayerPeer::get_available_packet_count() const {
-	return incoming_packets.size();
+	return _get_incoming_count();
 }
 
 Error ENetMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
-	ERR_FAIL_COND_V_MSG(incoming_packets.is_empty(), ERR_UNAVAILABLE, "No incoming packets available.");
+	ERR_FAIL_COND_V_MSG(_get_incoming_count() == 0, ERR_UNAVAILABLE, "No incoming packets available.");
 
 	_pop_current_packet();
 
-	current_packet = incoming_packets.front()->get();
-	incoming_packets.pop_front();
+	current_packet = incoming_packets[incoming_packets_read++];
+	if (incoming_packets_read == incoming_packets.size()) {
+		// Keeps the allocated capacity.
+		incoming_packets.clear();
+		incoming_packets_read = 0;
+	}
 
 	*r_buffer = (const uint8_t *)(current_packet.packet->data);
 	r_buffer_size = current_packet.packet->dataLength;
@@ -35,6 +35,7 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -79,7 +80,9 @@ private:
 		TransferMode transfer_mode = TRANSFER_MODE_RELIABLE;
 	};
 
-	List<Packet> incoming_packets;
+	// Consumed from incoming_packets_read onwards, so storage is reused between polls.
+	LocalVector<Packet> incoming_packets;
+	uint32_t incoming_packets_read = 0;
 
 	Packet current_packet;
 
@@ -87,6 +90,7 @@ private:
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
 	void _destroy_unused(ENetPacket *p_packet);
+	_FORCE_INLINE_ uint32_t _get_incoming_count() const { return incoming_packets.size() - incoming_packets_read; }
 	_FORCE_INLINE_ bool _is_active() const { return active_mode != MODE_NONE; }
 
 	IPAddress bind_ip;
@@ -34,12 +34,77 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
 
+struct EtcpakCompressionTask {
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t blocks = 0;
+	uint32_t width = 0;
+};
+
+struct EtcpakCompressionJobQueue {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	LocalVector<EtcpakCompressionTask> tasks;
+};
+
+static void _compress_etcpak_blocks(EtcpakType p_compress_type, const uint32_t *p_src, uint64_t *p_dst, uint32_t p_blocks, size_t p_width) {
+	switch (p_compress_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressBc1Dither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressBc3(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
+	const EtcpakCompressionJobQueue *job_queue = static_cast<const EtcpakCompressionJobQueue *>(p_job_queue);
+	const EtcpakCompressionTask &task = job_queue->tasks[p_index];
+	_compress_etcpak_blocks(job_queue->type, task.src, task.dst, task.blocks, task.width);
+}
+
 EtcpakType _determine_etc_type(Image::UsedChannels p_channels) {
 	switch (p_channels) {
 		case Image::USED_CHANNELS_L:
@@ -204,7 +269,16 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 	const uint8_t *src_read = r_img->get_data().ptr();
 
 	const int mip_count = has_mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	LocalVector<Vector<uint32_t>> padded_srcs;
+	padded_srcs.resize(mip_count + 1);
+
+	// Bytes per 4x4 block in the target format.
+	const int64_t block_size = Image::get_image_data_size(4, 4, target_format, false);
+
+	// Blocks are encoded independently, so each mip level is split into runs of block rows
+	// that are compressed in parallel. The output is the same as compressing serially.
+	EtcpakCompressionJobQueue job_queue;
+	job_queue.type = p_compress_type;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -213,12 +287,11 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 
 		// Ensure that mip offset is a multiple of 8 (etcpak expects uint64_t pointer).
 		ERR_FAIL_COND(dest_mip_ofs % 8 != 0);
-		uint64_t *dest_mip_write = reinterpret_cast<uint64_t *>(dest_write + dest_mip_ofs);
+		uint8_t *dest_mip_write = dest_write + dest_mip_ofs;
 
 		// Block size.
 		dest_mip_w = (dest_mip_w + 3) & ~3;
 		dest_mip_h = (dest_mip_h + 3) & ~3;
-		const uint32_t blocks = dest_mip_w * dest_mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int64_t src_mip_ofs, src_mip_size;
@@ -231,6 +304,7 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 		// Pad textures to nearest block by smearing.
 		if (dest_mip_w != src_mip_w || dest_mip_h != src_mip_h) {
 			// Reserve the buffer for padded image data.
+			Vector<uint32_t> &padded_src = padded_srcs[i];
 			padded_src.resize(dest_mip_w * dest_mip_h);
 			uint32_t *ptrw = padded_src.ptrw();
 
@@ -257,51 +331,26 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 			src_mip_read = padded_src.ptr();
 		}
 
-		switch (p_compress_type) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressBc1Dither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressBc3(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
+		const uint32_t blocks_per_row = dest_mip_w / 4;
+		const uint32_t block_rows = dest_mip_h / 4;
+		const uint32_t rows_per_task = MAX(1u, 4096 / blocks_per_row);
+		for (uint32_t row = 0; row < block_rows; row += rows_per_task) {
+			EtcpakCompressionTask task;
+			task.src = src_mip_read + row * 4 * dest_mip_w;
+			task.dst = reinterpret_cast<uint64_t *>(dest_mip_write + row * blocks_per_row * block_size);
+			task.blocks = MIN(rows_per_task, block_rows - row) * blocks_per_row;
+			task.width = dest_mip_w;
+			job_queue.tasks.push_back(task);
 		}
 	}
 
+	if (job_queue.tasks.size() == 1) {
+		_digest_job_queue(&job_queue, 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, job_queue.tasks.size(), -1, true, SNAME("etcpak Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	// Replace original image with compressed one.
 	r_img->set_data(width, height, has_mipmaps, target_format, dest_data);
 
@@ -46,6 +46,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/2d/node_2d.h"
 #include "scene/3d/bone_attachment_3d.h"
@@ -3983,7 +3984,7 @@ Dictionary GLTFDocument::_serialize_image(Ref<GLTFState> p_state, Ref<Image> p_i
 	return image_dict;
 }
 
-Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
+Ref<Image> GLTFDocument::_parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
 	Ref<Image> r_image;
 	r_image.instantiate();
 	// Check if any GLTFDocumentExtensions want to import this data as an image.
@@ -3996,6 +3997,10 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 			return r_image;
 		}
 	}
+	return r_image;
+}
+
+void GLTFDocument::_decode_image_bytes(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> r_image, String &r_file_extension) {
 	// If no extension wanted to import this data as an image, try to load a PNG or JPEG.
 	// First we honor the mime types if they were defined.
 	if (p_mime_type == "image/png") { // Load buffer as PNG.
@@ -4021,7 +4026,14 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 	if (r_image->is_empty()) {
 		ERR_PRINT(vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", p_index, p_mime_type));
 	}
-	return r_image;
+}
+
+void GLTFDocument::_decode_image_task(uint32_t p_task, ImageDecodeTask *p_tasks) {
+	ImageDecodeTask &task = p_tasks[p_task];
+	if (!task.needs_decode) {
+		return;
+	}
+	_decode_image_bytes(task.data, task.mime_type, task.index, task.image, task.file_extension);
 }
 
 void GLTFDocument::_parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_resource_uri, const String &p_file_extension, int p_index, Ref<Image> p_image) {
@@ -4145,6 +4157,8 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 	const Array &images = p_state->json["images"];
 	HashSet<String> used_names;
+	LocalVector<ImageDecodeTask> tasks;
+	tasks.reserve(images.size());
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &dict = images[i];
 
@@ -4179,11 +4193,15 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 			image_name += "_" + itos(i);
 		}
 
-		String resource_uri;
-
 		used_names.insert(image_name);
+		tasks.push_back(ImageDecodeTask());
+		ImageDecodeTask &task = tasks[tasks.size() - 1];
+		task.index = i;
+		task.name = image_name;
+
+		String &resource_uri = task.resource_uri;
 		// Load the image data. If we get a byte array, store here for later.
-		Vector<uint8_t> data;
+		Vector<uint8_t> &data = task.data;
 		if (dict.has("uri")) {
 			// Handles the first two bullet points from the spec (embedded data, or external file).
 			String uri = dict["uri"];
@@ -4207,8 +4225,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				if (ResourceLoader::exists(resource_uri)) {
 					Ref<Texture2D> texture = ResourceLoader::load(resource_uri, "Texture2D");
 					if (texture.is_valid()) {
-						p_state->images.push_back(texture);
-						p_state->source_images.push_back(texture->get_image());
+						task.texture = texture;
 						continue;
 					}
 				}
@@ -4223,9 +4240,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				data = FileAccess::get_file_as_bytes(resource_uri);
 				if (data.is_empty()) {
 					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, mime_type, resource_uri));
-					p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-					p_state->source_images.push_back(Ref<Image>());
-					continue;
+					continue; // Empty data, a placeholder is added below to keep count.
 				}
 			}
 		} else if (dict.has("bufferView")) {
@@ -4244,15 +4259,42 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		// Note: There are paths above that return early, so this point might not be reached.
 		if (data.is_empty()) {
 			WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded, no data found. Skipping it.", i));
+			continue;
+		}
+		// Extensions may be implemented in scripts, so give them a chance to claim
+		// the data on this thread. Anything left is decoded in parallel below.
+		task.mime_type = mime_type;
+		task.image = _parse_image_bytes_with_extensions(p_state, data, mime_type, i, task.file_extension);
+		task.needs_decode = task.image->is_empty();
+	}
+
+	// Decoding PNG and JPEG data dominates the time spent here, and each image is independent.
+	bool any_needs_decode = false;
+	for (const ImageDecodeTask &task : tasks) {
+		any_needs_decode = any_needs_decode || task.needs_decode;
+	}
+	if (any_needs_decode) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_decode_image_task, tasks.ptr(), tasks.size(), -1, true, "GLTFDocumentDecodeImages");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Saving and importing touches the state and the filesystem, so it stays serial and in order.
+	for (ImageDecodeTask &task : tasks) {
+		if (task.texture.is_valid()) {
+			p_state->images.push_back(task.texture);
+			p_state->source_images.push_back(task.texture->get_image());
+			continue;
+		}
+		if (task.data.is_empty()) {
 			p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 			p_state->source_images.push_back(Ref<Image>());
 			continue;
 		}
-		// Parse the image data from bytes into an Image resource and save if needed.
-		String file_extension;
-		Ref<Image> img = _parse_image_bytes_into_image(p_state, data, mime_type, i, file_extension);
-		img->set_name(image_name);
-		_parse_image_save_image(p_state, data, resource_uri, file_extension, i, img);
+		// Save the decoded image if needed.
+		task.image->set_name(task.name);
+		_parse_image_save_image(p_state, task.data, task.resource_uri, task.file_extension, task.index, task.image);
+		// Release the encoded bytes as soon as they are no longer needed.
+		task.data = Vector<uint8_t>();
 	}
 
 	print_verbose("glTF: Total images: " + itos(p_state->images.size()));
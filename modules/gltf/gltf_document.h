@@ -200,7 +200,20 @@ private:
 	Error _serialize_images(Ref<GLTFState> p_state);
 	Dictionary _serialize_image(Ref<GLTFState> p_state, Ref<Image> p_image, const String &p_image_format, float p_lossy_quality, Ref<GLTFDocumentExtension> p_image_save_extension);
 	Error _serialize_lights(Ref<GLTFState> p_state);
-	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	struct ImageDecodeTask {
+		int index = 0;
+		String name;
+		String mime_type;
+		String resource_uri;
+		String file_extension;
+		Vector<uint8_t> data;
+		Ref<Texture2D> texture; // Already loaded through ResourceLoader, no decoding needed.
+		Ref<Image> image;
+		bool needs_decode = false;
+	};
+	Ref<Image> _parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	static void _decode_image_bytes(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> r_image, String &r_file_extension);
+	void _decode_image_task(uint32_t p_task, ImageDecodeTask *p_tasks);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_resource_uri, const String &p_file_extension, int p_index, Ref<Image> p_image);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
 	Error _parse_textures(Ref<GLTFState> p_state);
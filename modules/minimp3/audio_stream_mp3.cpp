@@ -53,24 +53,37 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		beat_length_frames = mp3_stream->get_beat_count() * mp3_stream->sample_rate * 60 / mp3_stream->get_bpm();
 	}
 
+	const int channels = mp3_stream->channels;
+
 	while (todo && active) {
 		mp3dec_frame_info_t frame_info;
 		mp3d_sample_t *buf_frame = nullptr;
 
-		int samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, mp3_stream->channels);
+		// Take as many frames as the decoder has buffered, but don't read past the beat loop point.
+		int frames_to_read = todo;
+		if (beat_loop) {
+			frames_to_read = CLAMP(beat_length_frames - (int)frames_mixed, 1, todo);
+		}
+		int samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, frames_to_read * channels);
 
 		if (samples_mixed) {
-			p_buffer[p_frames - todo] = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
-			if (loop_fade_remaining < FADE_SIZE) {
-				p_buffer[p_frames - todo] += loop_fade[loop_fade_remaining] * (float(FADE_SIZE - loop_fade_remaining) / float(FADE_SIZE));
-				loop_fade_remaining++;
+			// The decoder always returns whole frames.
+			const int frames_read = samples_mixed / channels;
+			for (int i = 0; i < frames_read; i++) {
+				const mp3d_sample_t *frame = &buf_frame[i * channels];
+				AudioFrame &out = p_buffer[p_frames - todo];
+				out = AudioFrame(frame[0], frame[channels - 1]);
+				if (loop_fade_remaining < FADE_SIZE) {
+					out += loop_fade[loop_fade_remaining] * (float(FADE_SIZE - loop_fade_remaining) / float(FADE_SIZE));
+					loop_fade_remaining++;
+				}
+				--todo;
+				++frames_mixed;
 			}
-			--todo;
-			++frames_mixed;
 
 			if (beat_loop && (int)frames_mixed >= beat_length_frames) {
 				for (int i = 0; i < FADE_SIZE; i++) {
-					samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, mp3_stream->channels);
+					samples_mixed = mp3dec_ex_read_frame(&mp3d, &buf_frame, &frame_info, channels);
 					loop_fade[i] = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
 					if (!samples_mixed) {
 						break;
@@ -143,6 +143,7 @@ void SceneReplicationInterface::on_network_process() {
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		// Copy, property getters may free synchronizers or change visibility while syncing.
 		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
@@ -151,6 +152,9 @@ void SceneReplicationInterface::on_network_process() {
 		_send_sync(E.key, to_sync, sync_net_time, usec);
 		_send_delta(E.key, to_sync, usec, E.value.last_watch_usecs);
 	}
+	// States are only valid for the current frame.
+	sync_state_cache.clear();
+	delta_state_cache.clear();
 }
 
 Error SceneReplicationInterface::on_spawn(Object *p_obj, Variant p_config) {
@@ -707,6 +711,39 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 	return sync;
 }
 
+const SceneReplicationInterface::EncodedState *SceneReplicationInterface::_encode_delta_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, uint64_t p_usec, uint64_t p_last_usec) {
+	// Peers that last received this synchronizer at the same time get the same delta.
+	EncodedState *cached = delta_state_cache.getptr(p_oid);
+	if (cached && cached->last_usec == p_last_usec) {
+		return cached;
+	}
+	uint64_t indexes;
+	List<Variant> delta = p_sync->get_delta_state(p_usec, p_last_usec, indexes);
+	if (!delta.size()) {
+		// Not cached, a later peer with the same last update might still get changes once watched this frame.
+		return nullptr;
+	}
+
+	Vector<const Variant *> varp;
+	varp.resize(delta.size());
+	const Variant **vptr = varp.ptrw();
+	int i = 0;
+	for (const Variant &v : delta) {
+		vptr[i] = &v;
+		i++;
+	}
+	int size;
+	Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to encode delta state.");
+
+	EncodedState &state = delta_state_cache[p_oid];
+	state.last_usec = p_last_usec;
+	state.indexes = indexes;
+	state.data.resize(size);
+	MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), state.data.ptrw(), size);
+	return &state;
+}
+
 void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
 	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
@@ -720,25 +757,11 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue;
 		}
 		uint64_t last_usec = p_last_watch_usecs.has(oid) ? p_last_watch_usecs[oid] : 0;
-		uint64_t indexes;
-		List<Variant> delta = sync->get_delta_state(p_usec, last_usec, indexes);
-
-		if (!delta.size()) {
+		const EncodedState *state = _encode_delta_state(oid, sync, p_usec, last_usec);
+		if (!state) {
 			continue; // Nothing to update.
 		}
-
-		Vector<const Variant *> varp;
-		varp.resize(delta.size());
-		const Variant **vptr = varp.ptrw();
-		int i = 0;
-		for (const Variant &v : delta) {
-			vptr[i] = &v;
-			i++;
-		}
-		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
-
+		const int size = state->data.size();
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
@@ -748,9 +771,9 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 		}
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
-			ofs += encode_uint64(indexes, &ptr[ofs]);
+			ofs += encode_uint64(state->indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state->data.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -799,6 +822,27 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 	return OK;
 }
 
+const SceneReplicationInterface::EncodedState *SceneReplicationInterface::_encode_sync_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, Node *p_node) {
+	// The sync state does not depend on the peer, encode it once per frame.
+	EncodedState *cached = sync_state_cache.getptr(p_oid);
+	if (cached) {
+		return cached;
+	}
+	int size;
+	Vector<Variant> vars;
+	Vector<const Variant *> varp;
+	const List<NodePath> props = p_sync->get_replication_config_ptr()->get_sync_properties();
+	Error err = MultiplayerSynchronizer::get_state(props, p_node, vars, varp);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to retrieve sync state.");
+	err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to encode sync state.");
+
+	EncodedState &state = sync_state_cache[p_oid];
+	state.data.resize(size);
+	MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), state.data.ptrw(), size);
+	return &state;
+}
+
 void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
 	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 4 + sync_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
@@ -821,14 +865,11 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		const EncodedState *state = _encode_sync_state(oid, sync, node);
+		if (!state) {
+			continue;
+		}
+		const int size = state->data.size();
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
 		if (ofs + 4 + 4 + size > sync_mtu) {
@@ -839,7 +880,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state->data.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -70,6 +70,13 @@ private:
 		uint16_t last_sent_sync = 0;
 	};
 
+	// Synchronizer state encoded once per network frame and shared by all peers.
+	struct EncodedState {
+		uint64_t last_usec = 0;
+		uint64_t indexes = 0;
+		Vector<uint8_t> data;
+	};
+
 	// Replication state.
 	HashMap<int, PeerInfo> peers_info;
 	uint32_t last_net_id = 0;
@@ -91,6 +98,8 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	PackedByteArray packet_cache;
+	HashMap<ObjectID, EncodedState> sync_state_cache;
+	HashMap<ObjectID, EncodedState> delta_state_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
@@ -102,6 +111,8 @@ private:
 	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
+	const EncodedState *_encode_sync_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, Node *p_node);
+	const EncodedState *_encode_delta_state(const ObjectID &p_oid, MultiplayerSynchronizer *p_sync, uint64_t p_usec, uint64_t p_last_usec);
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
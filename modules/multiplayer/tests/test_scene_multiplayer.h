@@ -121,6 +121,78 @@ TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Object configuration add/r
 	}
 }
 
+// Frees another synchronized node when its property is read during sync.
+class _TestReplicationHazardNode : public Node {
+	GDCLASS(_TestReplicationHazardNode, Node);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_hazard", "hazard"), &_TestReplicationHazardNode::set_hazard);
+		ClassDB::bind_method(D_METHOD("get_hazard"), &_TestReplicationHazardNode::get_hazard);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "hazard"), "set_hazard", "get_hazard");
+	}
+
+public:
+	Node *victim = nullptr;
+	int hazard = 0;
+
+	void set_hazard(int p_hazard) { hazard = p_hazard; }
+	int get_hazard() {
+		if (victim) {
+			Node *node = victim;
+			victim = nullptr;
+			memdelete(node);
+		}
+		return hazard;
+	}
+};
+
+TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Synchronized node freed by a property getter") {
+	GDREGISTER_CLASS(_TestReplicationHazardNode);
+
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+	SceneTree::get_singleton()->set_multiplayer(scene_multiplayer);
+	Ref<MultiplayerPeer> multiplayer_peer = scene_multiplayer->get_multiplayer_peer();
+	multiplayer_peer->emit_signal(SNAME("peer_connected"), 42);
+
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	_TestReplicationHazardNode *hazard_node = memnew(_TestReplicationHazardNode);
+	MultiplayerSynchronizer *hazard_sync = memnew(MultiplayerSynchronizer);
+	Ref<SceneReplicationConfig> hazard_config;
+	hazard_config.instantiate();
+	hazard_config->add_property(NodePath(":hazard"));
+	hazard_sync->set_replication_config(hazard_config);
+	hazard_node->add_child(hazard_sync);
+
+	Node *victim = memnew(Node);
+	MultiplayerSynchronizer *victim_sync = memnew(MultiplayerSynchronizer);
+	Ref<SceneReplicationConfig> victim_config;
+	victim_config.instantiate();
+	victim_config->add_property(NodePath(":name"));
+	victim_sync->set_replication_config(victim_config);
+	victim->add_child(victim_sync);
+	hazard_node->victim = victim;
+
+	root->add_child(hazard_node);
+	root->add_child(victim);
+	hazard_sync->set_net_id(1);
+	victim_sync->set_net_id(2);
+	const ObjectID victim_id = victim->get_instance_id();
+	const ObjectID victim_sync_id = victim_sync->get_instance_id();
+
+	// Sending to the offline peer fails, only the iteration is under test here.
+	ERR_PRINT_OFF;
+	CHECK_EQ(scene_multiplayer->poll(), Error::OK);
+	CHECK(ObjectDB::get_instance(victim_id) == nullptr);
+	CHECK(ObjectDB::get_instance(victim_sync_id) == nullptr);
+	CHECK_EQ(scene_multiplayer->poll(), Error::OK);
+	ERR_PRINT_ON;
+
+	memdelete(hazard_node);
+}
+
 TEST_CASE("[Multiplayer][SceneMultiplayer] Root Path") {
 	Ref<SceneMultiplayer> scene_multiplayer;
 	scene_multiplayer.instantiate();
@@ -6543,7 +6543,7 @@ Glyph TextServerAdvanced::_shape_single_glyph(ShapedTextDataAdvanced *p_sd, char
 	return gl;
 }
 
-_FORCE_INLINE_ void TextServerAdvanced::_add_features(const Dictionary &p_source, Vector<hb_feature_t> &r_ftrs) {
+_FORCE_INLINE_ void TextServerAdvanced::_add_features(const Dictionary &p_source, LocalVector<hb_feature_t> &r_ftrs) {
 	for (const KeyValue<Variant, Variant> &key_value : p_source) {
 		int32_t value = key_value.value;
 		if (value >= 0) {
@@ -6589,6 +6589,18 @@ UBreakIterator *TextServerAdvanced::_create_line_break_iterator_for_locale(const
 	return ubrk_clone(bi, r_err);
 }
 
+hb_language_t TextServerAdvanced::_get_hb_language(const String &p_language) const {
+	// Avoids converting the language to ASCII and searching HarfBuzz's language list for every shaped run.
+	_THREAD_SAFE_METHOD_
+	const hb_language_t *lang = hb_languages.getptr(p_language);
+	if (lang) {
+		return *lang;
+	}
+	hb_language_t new_lang = hb_language_from_string(p_language.ascii().get_data(), -1);
+	hb_languages.insert(p_language, new_lang);
+	return new_lang;
+}
+
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, TypedArray<RID> p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end, RID p_prev_font) {
 	RID f;
 	int fs = p_sd->spans[p_span].font_size;
@@ -6723,20 +6735,19 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	hb_buffer_set_script(p_sd->hb_buffer, p_script);
 
 	if (p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		hb_buffer_set_language(p_sd->hb_buffer, _get_hb_language(TranslationServer::get_singleton()->get_tool_locale()));
 	} else {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
+		hb_buffer_set_language(p_sd->hb_buffer, _get_hb_language(p_sd->spans[p_span].language));
 	}
 
 	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
 
-	Vector<hb_feature_t> ftrs;
+	LocalVector<hb_feature_t> &ftrs = p_sd->hb_features;
+	ftrs.clear();
 	_add_features(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_features(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : ftrs.ptr(), ftrs.size());
 
 	unsigned int glyph_count = 0;
 	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
@@ -181,6 +181,11 @@ class TextServerAdvanced : public TextServerExtension {
 
 	UBreakIterator *_create_line_break_iterator_for_locale(const String &p_language, UErrorCode *r_err) const;
 
+	// HarfBuzz languages are never freed, so they can be cached for the lifetime of the server.
+	mutable HashMap<String, hb_language_t> hb_languages;
+
+	hb_language_t _get_hb_language(const String &p_language) const;
+
 	// Font cache data.
 
 #ifdef MODULE_FREETYPE_ENABLED
@@ -563,6 +568,7 @@ class TextServerAdvanced : public TextServerExtension {
 		Vector<Vector3i> bidi_override;
 		ScriptIterator *script_iter = nullptr;
 		hb_buffer_t *hb_buffer = nullptr;
+		LocalVector<hb_feature_t> hb_features; // Reused by every shaped run.
 
 		HashMap<int, bool> jstops;
 		HashMap<int, bool> breaks;
@@ -701,7 +707,7 @@ class TextServerAdvanced : public TextServerExtension {
 	Glyph _shape_single_glyph(ShapedTextDataAdvanced *p_sd, char32_t p_char, hb_script_t p_script, hb_direction_t p_direction, const RID &p_font, int64_t p_font_size);
 	_FORCE_INLINE_ RID _find_sys_font_for_text(const RID &p_fdef, const String &p_script_code, const String &p_language, const String &p_text);
 
-	_FORCE_INLINE_ void _add_features(const Dictionary &p_source, Vector<hb_feature_t> &r_ftrs);
+	_FORCE_INLINE_ void _add_features(const Dictionary &p_source, LocalVector<hb_feature_t> &r_ftrs);
 
 	Mutex ft_mutex;
 
@@ -3000,8 +3000,12 @@ Ref<Texture2D> Control::get_theme_icon(const StringName &p_name, const StringNam
 		}
 	}
 
-	if (data.theme_icon_cache.has(p_theme_type) && data.theme_icon_cache[p_theme_type].has(p_name)) {
-		return data.theme_icon_cache[p_theme_type][p_name];
+	const Theme::ThemeIconMap *type_cache = data.theme_icon_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<Texture2D> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3024,8 +3028,12 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
 		}
 	}
 
-	if (data.theme_style_cache.has(p_theme_type) && data.theme_style_cache[p_theme_type].has(p_name)) {
-		return data.theme_style_cache[p_theme_type][p_name];
+	const Theme::ThemeStyleMap *type_cache = data.theme_style_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<StyleBox> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3048,8 +3056,12 @@ Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_
 		}
 	}
 
-	if (data.theme_font_cache.has(p_theme_type) && data.theme_font_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_cache[p_theme_type][p_name];
+	const Theme::ThemeFontMap *type_cache = data.theme_font_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<Font> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3072,8 +3084,12 @@ int Control::get_theme_font_size(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (data.theme_font_size_cache.has(p_theme_type) && data.theme_font_size_cache[p_theme_type].has(p_name)) {
-		return data.theme_font_size_cache[p_theme_type][p_name];
+	const Theme::ThemeFontSizeMap *type_cache = data.theme_font_size_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const int *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3096,8 +3112,12 @@ Color Control::get_theme_color(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (data.theme_color_cache.has(p_theme_type) && data.theme_color_cache[p_theme_type].has(p_name)) {
-		return data.theme_color_cache[p_theme_type][p_name];
+	const Theme::ThemeColorMap *type_cache = data.theme_color_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Color *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3120,8 +3140,12 @@ int Control::get_theme_constant(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (data.theme_constant_cache.has(p_theme_type) && data.theme_constant_cache[p_theme_type].has(p_name)) {
-		return data.theme_constant_cache[p_theme_type][p_name];
+	const Theme::ThemeConstantMap *type_cache = data.theme_constant_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const int *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -3933,7 +3957,11 @@ void Control::_notification(int p_notification) {
 			queue_redraw();
 
 			update_minimum_size();
-			_size_changed();
+			// During theme propagation the size is updated once the whole subtree has been notified,
+			// so derived classes still see the previous size here.
+			if (!ThemeOwner::defer_size_update(this)) {
+				_size_changed();
+			}
 		} break;
 
 		case NOTIFICATION_VISIBILITY_CHANGED: {
@@ -307,6 +307,7 @@ private:
 	// Global relations.
 
 	friend class Viewport;
+	friend class ThemeOwner;
 
 	// Positioning and sizing.
 
@@ -1434,29 +1434,7 @@ void ItemList::_notification(int p_what) {
 				}
 			}
 
-			// Do a binary search to find the first item whose rect reaches below clip.position.y.
-			int first_item_visible;
-			{
-				int lo = 0;
-				int hi = items.size();
-				while (lo < hi) {
-					const int mid = (lo + hi) / 2;
-					const Rect2 &rcache = items[mid].rect_cache;
-					if (rcache.position.y + rcache.size.y < clip.position.y) {
-						lo = mid + 1;
-					} else {
-						hi = mid;
-					}
-				}
-
-				// We might end up with an item in columns 2, 3, etc, but we need the one from the first column.
-				// We can also end up in a state where lo reached hi, and so no items can be rendered; we skip that.
-				while (lo < hi && lo > 0 && items[lo].column > 0) {
-					lo -= 1;
-				}
-
-				first_item_visible = lo;
-			}
+			int first_item_visible = _find_first_item_below(clip.position.y);
 
 			Rect2 cursor_rcache; // Place to save the position of the cursor and draw it after everything else.
 
@@ -1927,6 +1905,28 @@ String ItemList::_atr(int p_idx, const String &p_text) const {
 	ERR_FAIL_V_MSG(atr(p_text), "Unexpected auto translate mode: " + itos(items[p_idx].auto_translate_mode));
 }
 
+int ItemList::_find_first_item_below(real_t p_y) const {
+	// Do a binary search to find the first item whose rect reaches below p_y.
+	int lo = 0;
+	int hi = items.size();
+	while (lo < hi) {
+		const int mid = (lo + hi) / 2;
+		const Rect2 &rcache = items[mid].rect_cache;
+		if (rcache.position.y + rcache.size.y < p_y) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	// We might end up with an item in columns 2, 3, etc, but we need the one from the first column.
+	// We can also end up in a state where lo reached hi, and so no items can be rendered; we skip that.
+	while (lo < hi && lo > 0 && items[lo].column > 0) {
+		lo -= 1;
+	}
+	return lo;
+}
+
 int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	Vector2 pos = p_pos;
 	pos -= theme_cache.panel_style->get_offset();
@@ -1940,9 +1940,15 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	int closest = -1;
 	int closest_dist = 0x7FFFFFFF;
 
-	for (int i = 0; i < items.size(); i++) {
+	// Items in rows above pos.y can't contain it, the closest item search still needs to check all of them.
+	int from = p_exact ? _find_first_item_below(pos.y) : 0;
+	for (int i = from; i < items.size(); i++) {
 		Rect2 rc = items[i].rect_cache;
 
+		if (p_exact && rc.position.y > pos.y) {
+			break; // Rows are sorted vertically, nothing below can contain pos.
+		}
+
 		if (i % current_columns == current_columns - 1) { // Make sure you can still select the last item when clicking past the column.
 			if (is_layout_rtl()) {
 				rc.size.width = get_size().width - scroll_bar_h->get_value() + rc.position.x;
@@ -149,6 +149,7 @@ private:
 	void _shape_text(int p_idx);
 	void _mouse_exited();
 	void _shift_range_select(int p_from, int p_to);
+	int _find_first_item_below(real_t p_y) const;
 
 	String _atr(int p_idx, const String &p_text) const;
 
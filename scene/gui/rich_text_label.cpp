@@ -433,6 +433,9 @@ float RichTextLabel::_resize_line(ItemFrame *p_frame, int p_line, const Ref<Font
 	}
 
 	l.offset.y = p_h;
+	if (p_frame == main) {
+		_invalidate_line_count_cache(p_line);
+	}
 	return _calculate_line_vertical_offset(l);
 }
 
@@ -667,6 +670,9 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	*r_char_offset = l.char_offset + l.char_count;
 
 	l.offset.y = p_h;
+	if (p_frame == main) {
+		_invalidate_line_count_cache(p_line);
+	}
 	return _calculate_line_vertical_offset(l);
 }
 
@@ -1918,6 +1924,64 @@ int RichTextLabel::_find_first_line(int p_from, int p_to, int p_vofs) const {
 	return MIN(l, (int)main->lines.size() - 1);
 }
 
+int RichTextLabel::_find_paragraph_by_char(int p_char) const {
+	// Character offsets of the valid paragraphs are non-decreasing, find the last one starting at or before `p_char`.
+	int l = 0;
+	int r = main->first_invalid_line.load();
+	while (l < r) {
+		int m = (l + r) / 2;
+		if (main->lines[m].char_offset <= p_char) {
+			l = m + 1;
+		} else {
+			r = m;
+		}
+	}
+	if (l > 0) {
+		const Line &line = main->lines[l - 1];
+		if (p_char < line.char_offset + line.char_count) {
+			return l - 1;
+		}
+	}
+	return -1;
+}
+
+int RichTextLabel::_find_paragraph_by_line(int p_line) const {
+	// Find the first valid paragraph ending after `p_line`, `line_count_cache` must be up to date.
+	int l = 0;
+	int r = (int)line_count_cache.size() - 1;
+	while (l < r) {
+		int m = (l + r) / 2;
+		if (line_count_cache[m + 1] <= p_line) {
+			l = m + 1;
+		} else {
+			r = m;
+		}
+	}
+	return l;
+}
+
+void RichTextLabel::_invalidate_line_count_cache(int p_paragraph) {
+	int from = line_count_cache_invalid_from.load();
+	while (p_paragraph < from && !line_count_cache_invalid_from.compare_exchange_weak(from, p_paragraph)) {
+	}
+}
+
+void RichTextLabel::_update_line_count_cache() const {
+	int to_line = main->first_invalid_line.load();
+	int from_line = line_count_cache_invalid_from.exchange(INT_MAX);
+	if (from_line == INT_MAX && (int)line_count_cache.size() == to_line + 1) {
+		return;
+	}
+	// Prefix sums up to the first changed paragraph are still correct, appended paragraphs only extend the array.
+	int valid_to = line_count_cache.is_empty() ? 0 : MIN(MIN(from_line, (int)line_count_cache.size() - 1), to_line);
+	line_count_cache.resize(to_line + 1);
+	line_count_cache[0] = 0;
+	for (int i = valid_to; i < to_line; i++) {
+		MutexLock lock(main->lines[i].text_buf->get_mutex());
+		line_count_cache[i + 1] = line_count_cache[i] + main->lines[i].text_buf->get_line_count();
+	}
+}
+
 _FORCE_INLINE_ float RichTextLabel::_calculate_line_vertical_offset(const RichTextLabel::Line &line) const {
 	return line.get_height(theme_cache.line_separation, theme_cache.paragraph_separation);
 }
@@ -4288,6 +4352,7 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 		main->lines.remove_at(p_paragraph);
 		current_char_ofs -= off;
 	}
+	_invalidate_line_count_cache(p_paragraph);
 
 	selection.click_frame = nullptr;
 	selection.click_item = nullptr;
@@ -4941,6 +5006,7 @@ void RichTextLabel::clear() {
 	main->lines.clear();
 	main->lines.resize(1);
 	main->first_invalid_line.store(0);
+	_invalidate_line_count_cache(0);
 	_invalidate_accessibility();
 
 	keyboard_focus_frame = nullptr;
@@ -6422,21 +6488,20 @@ void RichTextLabel::scroll_to_line(int p_line) {
 		return;
 	}
 	_validate_line_caches();
+	_update_line_count_cache();
 
-	int line_count = 0;
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
+	// Line at the end of a paragraph is resolved to that paragraph, not the start of the next one.
+	int to_line = (int)line_count_cache.size() - 1;
+	int i = _find_paragraph_by_line(p_line - 1);
+	if (i < to_line) {
 		MutexLock lock(main->lines[i].text_buf->get_mutex());
-		if ((line_count <= p_line) && (line_count + main->lines[i].text_buf->get_line_count() >= p_line)) {
-			float line_offset = 0.f;
-			for (int j = 0; j < p_line - line_count; j++) {
-				line_offset += main->lines[i].text_buf->get_line_ascent(j) + main->lines[i].text_buf->get_line_descent(j) + theme_cache.line_separation;
-			}
-			vscroll->set_value(main->lines[i].offset.y + line_offset);
-			queue_accessibility_update();
-			return;
+		float line_offset = 0.f;
+		for (int j = 0; j < p_line - line_count_cache[i]; j++) {
+			line_offset += main->lines[i].text_buf->get_line_ascent(j) + main->lines[i].text_buf->get_line_descent(j) + theme_cache.line_separation;
 		}
-		line_count += main->lines[i].text_buf->get_line_count();
+		vscroll->set_value(main->lines[i].offset.y + line_offset);
+		queue_accessibility_update();
+		return;
 	}
 	vscroll->set_value(vscroll->get_max());
 	queue_accessibility_update();
@@ -6444,19 +6509,20 @@ void RichTextLabel::scroll_to_line(int p_line) {
 
 float RichTextLabel::get_line_offset(int p_line) {
 	_validate_line_caches();
+	if (p_line < 0) {
+		return 0;
+	}
+	_update_line_count_cache();
 
-	int line_count = 0;
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
+	int to_line = (int)line_count_cache.size() - 1;
+	int i = _find_paragraph_by_line(p_line - 1);
+	if (i < to_line) {
 		MutexLock lock(main->lines[i].text_buf->get_mutex());
-		if ((line_count <= p_line) && (p_line <= line_count + main->lines[i].text_buf->get_line_count())) {
-			float line_offset = 0.f;
-			for (int j = 0; j < p_line - line_count; j++) {
-				line_offset += main->lines[i].text_buf->get_line_ascent(j) + main->lines[i].text_buf->get_line_descent(j) + theme_cache.line_separation;
-			}
-			return main->lines[i].offset.y + line_offset;
+		float line_offset = 0.f;
+		for (int j = 0; j < p_line - line_count_cache[i]; j++) {
+			line_offset += main->lines[i].text_buf->get_line_ascent(j) + main->lines[i].text_buf->get_line_descent(j) + theme_cache.line_separation;
 		}
-		line_count += main->lines[i].text_buf->get_line_count();
+		return main->lines[i].offset.y + line_offset;
 	}
 	return 0;
 }
@@ -6473,32 +6539,22 @@ float RichTextLabel::get_paragraph_offset(int p_paragraph) {
 
 int RichTextLabel::get_line_count() const {
 	const_cast<RichTextLabel *>(this)->_validate_line_caches();
+	_update_line_count_cache();
 
-	int line_count = 0;
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
-		MutexLock lock(main->lines[i].text_buf->get_mutex());
-		line_count += main->lines[i].text_buf->get_line_count();
-	}
-	return line_count;
+	return line_count_cache[line_count_cache.size() - 1];
 }
 
 Vector2i RichTextLabel::get_line_range(int p_line) {
 	const_cast<RichTextLabel *>(this)->_validate_line_caches();
+	_update_line_count_cache();
 
-	int line_count = 0;
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
+	int to_line = (int)line_count_cache.size() - 1;
+	int i = _find_paragraph_by_line(p_line);
+	if (i < to_line) {
 		MutexLock lock(main->lines[i].text_buf->get_mutex());
-		int lc = main->lines[i].text_buf->get_line_count();
-
-		if (p_line < line_count + lc) {
-			Vector2i char_offset = Vector2i(main->lines[i].char_offset, main->lines[i].char_offset);
-			Vector2i line_range = main->lines[i].text_buf->get_line_range(p_line - line_count);
-			return char_offset + line_range;
-		}
-
-		line_count += lc;
+		Vector2i char_offset = Vector2i(main->lines[i].char_offset, main->lines[i].char_offset);
+		Vector2i line_range = main->lines[i].text_buf->get_line_range(p_line - line_count_cache[i]);
+		return char_offset + line_range;
 	}
 	return Vector2i();
 }
@@ -7225,16 +7281,13 @@ void RichTextLabel::set_visible_ratio(float p_ratio) {
 			int new_vc = (visible_characters < 0) ? get_total_character_count() : visible_characters;
 			int old_vc = (prev_vc < 0) ? get_total_character_count() : prev_vc;
 			int to_line = main->first_invalid_line.load();
-			int old_from_l = to_line;
-			int new_from_l = to_line;
-			for (int i = 0; i < to_line; i++) {
-				const Line &l = main->lines[i];
-				if (l.char_offset <= old_vc && l.char_offset + l.char_count > old_vc) {
-					old_from_l = i;
-				}
-				if (l.char_offset <= new_vc && l.char_offset + l.char_count > new_vc) {
-					new_from_l = i;
-				}
+			int old_from_l = _find_paragraph_by_char(old_vc);
+			int new_from_l = _find_paragraph_by_char(new_vc);
+			if (old_from_l < 0) {
+				old_from_l = to_line;
+			}
+			if (new_from_l < 0) {
+				new_from_l = to_line;
 			}
 			Rect2 text_rect = _get_text_rect();
 			int first_invalid = MIN(new_from_l, old_from_l);
@@ -7711,16 +7764,13 @@ void RichTextLabel::set_visible_characters(int p_visible) {
 			int new_vc = (visible_characters < 0) ? get_total_character_count() : visible_characters;
 			int old_vc = (prev_vc < 0) ? get_total_character_count() : prev_vc;
 			int to_line = main->first_invalid_line.load();
-			int old_from_l = to_line;
-			int new_from_l = to_line;
-			for (int i = 0; i < to_line; i++) {
-				const Line &l = main->lines[i];
-				if (l.char_offset <= old_vc && l.char_offset + l.char_count > old_vc) {
-					old_from_l = i;
-				}
-				if (l.char_offset <= new_vc && l.char_offset + l.char_count > new_vc) {
-					new_from_l = i;
-				}
+			int old_from_l = _find_paragraph_by_char(old_vc);
+			int new_from_l = _find_paragraph_by_char(new_vc);
+			if (old_from_l < 0) {
+				old_from_l = to_line;
+			}
+			if (new_from_l < 0) {
+				new_from_l = to_line;
 			}
 			Rect2 text_rect = _get_text_rect();
 			int first_invalid = MIN(new_from_l, old_from_l);
@@ -7758,46 +7808,36 @@ int RichTextLabel::get_visible_characters() const {
 int RichTextLabel::get_character_line(int p_char) {
 	_validate_line_caches();
 
-	int line_count = 0;
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
-		MutexLock lock(main->lines[i].text_buf->get_mutex());
-		int char_offset = main->lines[i].char_offset;
-		int char_count = main->lines[i].char_count;
-		if (char_offset <= p_char && p_char < char_offset + char_count) {
-			int lc = main->lines[i].text_buf->get_line_count();
-			for (int j = 0; j < lc; j++) {
-				Vector2i range = main->lines[i].text_buf->get_line_range(j);
-				if (char_offset + range.x <= p_char && p_char < char_offset + range.y) {
-					break;
-				}
-				if (char_offset + range.x > p_char && line_count > 0) {
-					line_count--; // Character is not rendered and is between the lines (e.g., edge space).
-					break;
-				}
-				if (j != lc - 1) {
-					line_count++;
-				}
-			}
-			return line_count;
-		} else {
-			line_count += main->lines[i].text_buf->get_line_count();
+	int i = _find_paragraph_by_char(p_char);
+	if (i < 0) {
+		return -1;
+	}
+	_update_line_count_cache();
+
+	MutexLock lock(main->lines[i].text_buf->get_mutex());
+	int line_count = line_count_cache[i];
+	int char_offset = main->lines[i].char_offset;
+	int lc = main->lines[i].text_buf->get_line_count();
+	for (int j = 0; j < lc; j++) {
+		Vector2i range = main->lines[i].text_buf->get_line_range(j);
+		if (char_offset + range.x <= p_char && p_char < char_offset + range.y) {
+			break;
+		}
+		if (char_offset + range.x > p_char && line_count > 0) {
+			line_count--; // Character is not rendered and is between the lines (e.g., edge space).
+			break;
+		}
+		if (j != lc - 1) {
+			line_count++;
 		}
 	}
-	return -1;
+	return line_count;
 }
 
 int RichTextLabel::get_character_paragraph(int p_char) {
 	_validate_line_caches();
 
-	int to_line = main->first_invalid_line.load();
-	for (int i = 0; i < to_line; i++) {
-		int char_offset = main->lines[i].char_offset;
-		if (char_offset <= p_char && p_char < char_offset + main->lines[i].char_count) {
-			return i;
-		}
-	}
-	return -1;
+	return _find_paragraph_by_char(p_char);
 }
 
 int RichTextLabel::get_total_character_count() const {
@@ -8006,6 +8046,7 @@ RichTextLabel::RichTextLabel(const String &p_text) {
 	main->first_invalid_line.store(0);
 	main->first_resized_line.store(0);
 	main->first_invalid_font_line.store(0);
+	line_count_cache_invalid_from.store(0);
 	current_frame = main;
 
 	vscroll = memnew(VScrollBar);
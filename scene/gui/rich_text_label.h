@@ -519,6 +519,11 @@ private:
 	std::atomic<double> loaded;
 	std::atomic<bool> parsing_bbcode;
 
+	// Lowest paragraph of `main` reshaped or removed since `line_count_cache` was last updated.
+	mutable std::atomic<int> line_count_cache_invalid_from;
+	// Prefix sums of the visual line counts of the valid paragraphs of `main`, entry `i` is the first line of paragraph `i`.
+	mutable LocalVector<int> line_count_cache;
+
 	uint64_t loading_started = 0;
 	int progress_delay = 1000;
 
@@ -680,6 +685,10 @@ private:
 	void _update_fx(ItemFrame *p_frame, double p_delta_time);
 	void _scroll_changed(double);
 	int _find_first_line(int p_from, int p_to, int p_vofs) const;
+	int _find_paragraph_by_char(int p_char) const;
+	int _find_paragraph_by_line(int p_line) const;
+	void _invalidate_line_count_cache(int p_paragraph);
+	void _update_line_count_cache() const;
 
 	_FORCE_INLINE_ float _calculate_line_vertical_offset(const Line &line) const;
 
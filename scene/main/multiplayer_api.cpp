@@ -63,6 +63,49 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 #define ENCODE_16 1 << 6
 #define ENCODE_32 2 << 6
 #define ENCODE_64 3 << 6
+
+// Floating-point components (float, Vector2, Vector3) are stored right after
+// the meta byte, as 32-bit floats (ENCODE_32) when that is lossless, or as
+// 64-bit doubles (ENCODE_64) otherwise. Older peers send them through
+// encode_variant(), whose header leaves the encode mode at ENCODE_8, so that
+// mode is still decoded as a regular variant.
+template <typename T>
+static int _encode_components(const T *p_components, int p_count, uint8_t *r_buffer, uint8_t &r_encode_mode) {
+	bool fits_float = true;
+	for (int i = 0; i < p_count && fits_float; i++) {
+		fits_float = (double)(float)p_components[i] == (double)p_components[i];
+	}
+
+	r_encode_mode = fits_float ? ENCODE_32 : ENCODE_64;
+	const int component_size = fits_float ? 4 : 8;
+	if (r_buffer) {
+		for (int i = 0; i < p_count; i++) {
+			if (fits_float) {
+				encode_float(p_components[i], r_buffer + i * component_size);
+			} else {
+				encode_double(p_components[i], r_buffer + i * component_size);
+			}
+		}
+	}
+	return component_size * p_count;
+}
+
+template <typename T>
+static Error _decode_components(T *r_components, int p_count, const uint8_t *p_buffer, int p_len, uint8_t p_encode_mode, int &r_len) {
+	ERR_FAIL_COND_V(p_encode_mode != ENCODE_32 && p_encode_mode != ENCODE_64, ERR_INVALID_DATA);
+	const int component_size = p_encode_mode == ENCODE_32 ? 4 : 8;
+	ERR_FAIL_COND_V(p_len < component_size * p_count, ERR_INVALID_DATA);
+
+	for (int i = 0; i < p_count; i++) {
+		if (p_encode_mode == ENCODE_32) {
+			r_components[i] = decode_float(p_buffer + i * component_size);
+		} else {
+			r_components[i] = decode_double(p_buffer + i * component_size);
+		}
+	}
+	r_len = component_size * p_count;
+	return OK;
+}
 Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_allow_object_decoding) {
 	// Unreachable because `VARIANT_MAX` == 38 and `ENCODE_VARIANT_MASK` == 77
 	CRASH_COND(p_variant.get_type() > VARIANT_META_TYPE_MASK);
@@ -122,6 +165,27 @@ Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint
 				buf[0] = encode_mode | p_variant.get_type();
 			}
 		} break;
+		case Variant::FLOAT: {
+			const double val = p_variant;
+			r_len += 1 + _encode_components(&val, 1, buf ? buf + 1 : nullptr, encode_mode);
+			if (buf) {
+				buf[0] = encode_mode | p_variant.get_type();
+			}
+		} break;
+		case Variant::VECTOR2: {
+			const Vector2 val = p_variant;
+			r_len += 1 + _encode_components(&val.coord[0], 2, buf ? buf + 1 : nullptr, encode_mode);
+			if (buf) {
+				buf[0] = encode_mode | p_variant.get_type();
+			}
+		} break;
+		case Variant::VECTOR3: {
+			const Vector3 val = p_variant;
+			r_len += 1 + _encode_components(&val.coord[0], 3, buf ? buf + 1 : nullptr, encode_mode);
+			if (buf) {
+				buf[0] = encode_mode | p_variant.get_type();
+			}
+		} break;
 		default:
 			// Any other case is not yet compressed.
 			Error err = encode_variant(p_variant, r_buffer, r_len, p_allow_object_decoding);
@@ -196,6 +260,45 @@ Error MultiplayerAPI::decode_and_decompress_variant(Variant &r_variant, const ui
 				}
 			}
 		} break;
+		case Variant::FLOAT: {
+			if (encode_mode == ENCODE_8) {
+				return decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
+			}
+			double val = 0;
+			int vlen = 0;
+			Error err = _decode_components(&val, 1, buf + 1, len - 1, encode_mode, vlen);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = val;
+			if (r_len) {
+				*r_len = 1 + vlen;
+			}
+		} break;
+		case Variant::VECTOR2: {
+			if (encode_mode == ENCODE_8) {
+				return decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
+			}
+			Vector2 val;
+			int vlen = 0;
+			Error err = _decode_components(&val.coord[0], 2, buf + 1, len - 1, encode_mode, vlen);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = val;
+			if (r_len) {
+				*r_len = 1 + vlen;
+			}
+		} break;
+		case Variant::VECTOR3: {
+			if (encode_mode == ENCODE_8) {
+				return decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
+			}
+			Vector3 val;
+			int vlen = 0;
+			Error err = _decode_components(&val.coord[0], 3, buf + 1, len - 1, encode_mode, vlen);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = val;
+			if (r_len) {
+				*r_len = 1 + vlen;
+			}
+		} break;
 		default:
 			Error err = decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
 			if (err != OK) {
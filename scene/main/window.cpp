@@ -2353,8 +2353,12 @@ Ref<Texture2D> Window::get_theme_icon(const StringName &p_name, const StringName
 		}
 	}
 
-	if (theme_icon_cache.has(p_theme_type) && theme_icon_cache[p_theme_type].has(p_name)) {
-		return theme_icon_cache[p_theme_type][p_name];
+	const Theme::ThemeIconMap *type_cache = theme_icon_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<Texture2D> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -2377,8 +2381,12 @@ Ref<StyleBox> Window::get_theme_stylebox(const StringName &p_name, const StringN
 		}
 	}
 
-	if (theme_style_cache.has(p_theme_type) && theme_style_cache[p_theme_type].has(p_name)) {
-		return theme_style_cache[p_theme_type][p_name];
+	const Theme::ThemeStyleMap *type_cache = theme_style_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<StyleBox> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -2401,8 +2409,12 @@ Ref<Font> Window::get_theme_font(const StringName &p_name, const StringName &p_t
 		}
 	}
 
-	if (theme_font_cache.has(p_theme_type) && theme_font_cache[p_theme_type].has(p_name)) {
-		return theme_font_cache[p_theme_type][p_name];
+	const Theme::ThemeFontMap *type_cache = theme_font_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Ref<Font> *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -2425,8 +2437,12 @@ int Window::get_theme_font_size(const StringName &p_name, const StringName &p_th
 		}
 	}
 
-	if (theme_font_size_cache.has(p_theme_type) && theme_font_size_cache[p_theme_type].has(p_name)) {
-		return theme_font_size_cache[p_theme_type][p_name];
+	const Theme::ThemeFontSizeMap *type_cache = theme_font_size_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const int *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -2449,8 +2465,12 @@ Color Window::get_theme_color(const StringName &p_name, const StringName &p_them
 		}
 	}
 
-	if (theme_color_cache.has(p_theme_type) && theme_color_cache[p_theme_type].has(p_name)) {
-		return theme_color_cache[p_theme_type][p_name];
+	const Theme::ThemeColorMap *type_cache = theme_color_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const Color *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -2473,8 +2493,12 @@ int Window::get_theme_constant(const StringName &p_name, const StringName &p_the
 		}
 	}
 
-	if (theme_constant_cache.has(p_theme_type) && theme_constant_cache[p_theme_type].has(p_name)) {
-		return theme_constant_cache[p_theme_type][p_name];
+	const Theme::ThemeConstantMap *type_cache = theme_constant_cache.getptr(p_theme_type);
+	if (type_cache) {
+		const int *cached = type_cache->getptr(p_name);
+		if (cached) {
+			return *cached;
+		}
 	}
 
 	Vector<StringName> theme_types;
@@ -80,6 +80,13 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	struct LODGenerationData {
+		Surface *surfaces = nullptr;
+		float normal_merge_angle = 0.0f;
+		LocalVector<Transform3D> bone_transforms;
+	};
+	void _generate_surface_lods(uint32_t p_surface, const LODGenerationData *p_data);
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
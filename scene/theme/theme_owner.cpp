@@ -162,6 +162,8 @@ void ThemeOwner::propagate_theme_changed(Node *p_to_node, Node *p_owner_node, bo
 		return;
 	}
 
+	propagation_depth++;
+
 	bool assign = p_assign;
 	if (c) {
 		if (c != p_owner_node && c->get_theme().is_valid()) {
@@ -197,6 +199,26 @@ void ThemeOwner::propagate_theme_changed(Node *p_to_node, Node *p_owner_node, bo
 	for (int i = 0; i < p_to_node->get_child_count(); i++) {
 		propagate_theme_changed(p_to_node->get_child(i), p_owner_node, p_notify, assign);
 	}
+
+	propagation_depth--;
+	if (propagation_depth == 0 && !pending_size_updates.is_empty()) {
+		// Every control in the subtree has invalidated its minimum size by now, update them top-down.
+		LocalVector<ObjectID> pending = std::move(pending_size_updates);
+		for (const ObjectID &id : pending) {
+			Control *pending_c = ObjectDB::get_instance<Control>(id);
+			if (pending_c) {
+				pending_c->_size_changed();
+			}
+		}
+	}
+}
+
+bool ThemeOwner::defer_size_update(Control *p_control) {
+	if (propagation_depth == 0) {
+		return false;
+	}
+	pending_size_updates.push_back(p_control->get_instance_id());
+	return true;
 }
 
 // Theme lookup.
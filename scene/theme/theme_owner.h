@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/object/object.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/theme.h"
 
 class Control;
@@ -47,6 +48,12 @@ class ThemeOwner : public Object {
 	Window *owner_window = nullptr;
 	ThemeContext *owner_context = nullptr;
 
+	// Controls that postponed their size update until the current theme propagation ends,
+	// so that minimum sizes are recomputed once for the whole subtree.
+	// Per thread, as scenes can be built and themed off-tree on other threads.
+	static inline thread_local int propagation_depth = 0;
+	static inline thread_local LocalVector<ObjectID> pending_size_updates;
+
 	void _owner_context_changed();
 	ThemeContext *_get_active_owner_context() const;
 
@@ -67,6 +74,7 @@ public:
 	void assign_theme_on_parented(Node *p_for_node);
 	void clear_theme_on_unparented(Node *p_for_node);
 	void propagate_theme_changed(Node *p_to_node, Node *p_owner_node, bool p_notify, bool p_assign);
+	static bool defer_size_update(Control *p_control);
 
 	// Theme lookup.
 
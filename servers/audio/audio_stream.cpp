@@ -192,6 +192,24 @@ void AudioStreamPlaybackResampled::_bind_methods() {
 	GDVIRTUAL_BIND(_get_stream_sampling_rate);
 }
 
+void AudioStreamPlaybackResampled::_refill_internal_buffer() {
+	while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
+		internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
+		internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
+		internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
+		internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
+		int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+		if (mixed_frames != INTERNAL_BUFFER_LEN) {
+			// internal_buffer[mixed_frames] is the first frame of silence.
+			internal_buffer_end = mixed_frames;
+		} else {
+			// The internal buffer does not contain the first frame of silence.
+			internal_buffer_end = -1;
+		}
+		mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
+	}
+}
+
 int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	float target_rate = AudioServer::get_singleton()->get_mix_rate();
 	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
@@ -201,45 +219,51 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	int mixed_frames_total = -1;
 
 	int i;
-	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
-			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
-			mixed_frames_total = i;
-		}
+	if (mix_increment == FP_LEN && (mix_offset & FP_MASK) == 0) {
+		// Playing at the stream rate without a fractional offset, so every output frame is a source frame.
+		// Copy whole runs instead of interpolating frame by frame.
+		i = 0;
+		while (i < p_frames) {
+			uint32_t pos = uint32_t(mix_offset >> FP_BITS);
+			uint32_t idx = CUBIC_INTERP_HISTORY + pos;
+			int run = MIN(p_frames - i, int(INTERNAL_BUFFER_LEN - pos));
+
+			if (mixed_frames_total == -1 && idx + run > internal_buffer_end) {
+				mixed_frames_total = i + (internal_buffer_end > idx ? internal_buffer_end - idx : 0);
+			}
 
-		float mu2 = mu * mu;
-		float h11 = mu2 * (mu - 1);
-		float z = mu2 - h11;
-		float h01 = z - h11;
-		float h10 = mu - z;
-
-		p_buffer[i] = y1 + (y2 - y1) * h01 + ((y2 - y0) * h10 + (y3 - y1) * h11) * 0.5;
-
-		mix_offset += mix_increment;
-
-		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
-			if (mixed_frames != INTERNAL_BUFFER_LEN) {
-				// internal_buffer[mixed_frames] is the first frame of silence.
-				internal_buffer_end = mixed_frames;
-			} else {
-				// The internal buffer does not contain the first frame of silence.
-				internal_buffer_end = -1;
+			memcpy(&p_buffer[i], &internal_buffer[idx - 2], run * sizeof(AudioFrame));
+			i += run;
+			mix_offset += uint64_t(run) << FP_BITS;
+			_refill_internal_buffer();
+		}
+	} else {
+		for (i = 0; i < p_frames; i++) {
+			uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
+			//standard cubic interpolation (great quality/performance ratio)
+			//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+			float mu = (mix_offset & FP_MASK) / float(FP_LEN);
+			AudioFrame y0 = internal_buffer[idx - 3];
+			AudioFrame y1 = internal_buffer[idx - 2];
+			AudioFrame y2 = internal_buffer[idx - 1];
+			AudioFrame y3 = internal_buffer[idx - 0];
+
+			if (idx >= internal_buffer_end && mixed_frames_total == -1) {
+				// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
+				mixed_frames_total = i;
 			}
-			mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
+
+			float mu2 = mu * mu;
+			float h11 = mu2 * (mu - 1);
+			float z = mu2 - h11;
+			float h01 = z - h11;
+			float h10 = mu - z;
+
+			p_buffer[i] = y1 + (y2 - y1) * h01 + ((y2 - y0) * h10 + (y3 - y1) * h11) * 0.5;
+
+			mix_offset += mix_increment;
+
+			_refill_internal_buffer();
 		}
 	}
 	if (mixed_frames_total == -1 && i == p_frames) {
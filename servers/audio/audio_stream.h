@@ -140,6 +140,8 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	void _refill_internal_buffer();
+
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
@@ -537,6 +537,7 @@ void AudioServer::_mix_step() {
 	}
 
 	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
+	const float channel_disable_threshold_linear = Math::db_to_linear(channel_disable_threshold_db);
 	for (int i = buses.size() - 1; i >= 0; i--) {
 		Bus *bus = buses[i];
 
@@ -563,18 +564,14 @@ void AudioServer::_mix_step() {
 #endif
 
 				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					Bus::Channel &channel = bus->channels.write[k];
+					if (!(channel.active || channel.effect_instances[j]->process_silence())) {
 						continue;
 					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+					channel.effect_instances.write[j]->process(channel.buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
 
-				// Swap buffers, so internal buffer always has the right data.
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+					// Swap buffers, so internal buffer always has the right data.
+					SWAP(channel.buffer, temp_buffer.write[k]);
 				}
 
 #ifdef DEBUG_ENABLED
@@ -589,13 +586,23 @@ void AudioServer::_mix_step() {
 
 		if (i > 0) {
 			// Everything has a send except for the master bus.
-			if (!bus_map.has(bus->send)) {
+			Bus *const *send_bus = bus_map.getptr(bus->send);
+			if (!send_bus || (*send_bus)->index_cache >= bus->index_cache) { // Missing or invalid, send to master.
 				send = buses[0];
 			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
-					send = buses[0];
-				}
+				send = *send_bus;
+			}
+		}
+
+		// Same for all channels of the bus.
+		float volume = Math::db_to_linear(bus->volume_db);
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
 		}
 
@@ -609,18 +616,6 @@ void AudioServer::_mix_step() {
 
 			AudioFrame peak = AudioFrame(0, 0);
 
-			float volume = Math::db_to_linear(bus->volume_db);
-
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
-			}
-
 			// Apply volume and compute peak.
 			for (uint32_t j = 0; j < buffer_size; j++) {
 				buf[j] *= volume;
@@ -640,7 +635,7 @@ void AudioServer::_mix_step() {
 			if (!bus->channels[k].used) {
 				// See if any audio is contained, because channel was not used.
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				if (MAX(peak.right, peak.left) > channel_disable_threshold_linear) {
 					bus->channels.write[k].last_mix_with_audio = mix_frames;
 				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
 					bus->channels.write[k].active = false;
@@ -664,6 +659,10 @@ void AudioServer::_mix_step() {
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+	// The volume is linearly interpolated over the buffer, step it instead of dividing for every frame.
+	const AudioFrame vol_step = (p_vol_final - p_vol_start) * (1.0f / buffer_size);
+
 	// TODO: In the future it could be nice to replace all of these hardcoded effects with something a bit cleaner and more flexible, but for now this is what we do to support 3D audio players.
 	if (p_highshelf_gain != 0) {
 		AudioFilterSW filter;
@@ -684,25 +683,26 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->update_coeffs(buffer_size);
 
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
+			AudioFrame vol = p_vol_start + vol_step * (float)frame_idx;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.left);
 			p_processor_r->process_one_interp(mixed.right);
 			p_out_buf[frame_idx] += mixed;
 		}
 
+	} else if (p_vol_start.left == p_vol_final.left && p_vol_start.right == p_vol_final.right) {
+		// Constant volume.
+		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
+			p_out_buf[frame_idx] += p_vol_final * p_source_buf[frame_idx];
+		}
 	} else {
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
+			p_out_buf[frame_idx] += (p_vol_start + vol_step * (float)frame_idx) * p_source_buf[frame_idx];
 		}
 	}
 }
 
-AudioServer::AudioStreamPlaybackListNode *AudioServer::_find_playback_list_node(Ref<AudioStreamPlayback> p_playback) {
+AudioServer::AudioStreamPlaybackListNode *AudioServer::_find_playback_list_node(const Ref<AudioStreamPlayback> &p_playback) {
 	for (AudioStreamPlaybackListNode *playback_list_node : playback_list) {
 		if (playback_list_node->stream_playback == p_playback) {
 			return playback_list_node;
@@ -762,8 +762,9 @@ int AudioServer::thread_get_mix_buffer_size() const {
 }
 
 int AudioServer::thread_find_bus_index(const StringName &p_name) {
-	if (bus_map.has(p_name)) {
-		return bus_map[p_name]->index_cache;
+	Bus *const *bus = bus_map.getptr(p_name);
+	if (bus) {
+		return (*bus)->index_cache;
 	} else {
 		return 0;
 	}
@@ -1350,6 +1351,13 @@ void AudioServer::set_playback_bus_volumes_linear(Ref<AudioStreamPlayback> p_pla
 		idx++;
 	}
 
+	// Players update their volumes every frame, avoid swapping in identical details (e.g. for a muted, out of range player).
+	old_bus_details = playback_node->bus_details.load();
+	if (old_bus_details && *old_bus_details == *new_bus_details) {
+		delete new_bus_details;
+		return;
+	}
+
 	do {
 		old_bus_details = playback_node->bus_details.load();
 	} while (!playback_node->bus_details.compare_exchange_strong(old_bus_details, new_bus_details));
@@ -273,6 +273,26 @@ private:
 		bool bus_active[MAX_BUSES_PER_PLAYBACK] = {};
 		StringName bus[MAX_BUSES_PER_PLAYBACK];
 		AudioFrame volume[MAX_BUSES_PER_PLAYBACK][MAX_CHANNELS_PER_BUS];
+
+		bool operator==(const AudioStreamPlaybackBusDetails &p_other) const {
+			for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
+				if (bus_active[i] != p_other.bus_active[i]) {
+					return false;
+				}
+				if (!bus_active[i]) {
+					continue;
+				}
+				if (bus[i] != p_other.bus[i]) {
+					return false;
+				}
+				for (int j = 0; j < MAX_CHANNELS_PER_BUS; j++) {
+					if (volume[i][j].left != p_other.volume[i][j].left || volume[i][j].right != p_other.volume[i][j].right) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
 	};
 
 	struct AudioStreamPlaybackListNode {
@@ -332,7 +352,7 @@ private:
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
-	AudioStreamPlaybackListNode *_find_playback_list_node(Ref<AudioStreamPlayback> p_playback);
+	AudioStreamPlaybackListNode *_find_playback_list_node(const Ref<AudioStreamPlayback> &p_playback);
 
 	struct CallbackItem {
 		AudioCallback callback;
@@ -285,6 +285,19 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 				vformat("Parsing valid unicode escape sequence with value `0020` as JSON should return the expected value."));
 	}
 
+	SUBCASE("Escape sequences between plain text") {
+		json.parse(R"("Hello\tworld\n\u0041BC\\")");
+
+		CHECK_MESSAGE(
+				json.get_error_line() == 0,
+				"Parsing escape sequences between plain text as JSON should parse successfully.");
+
+		String json_value = json.get_data();
+		CHECK_MESSAGE(
+				json_value == "Hello\tworld\nABC\\",
+				"Parsing escape sequences between plain text as JSON should return the expected value.");
+	}
+
 	SUBCASE("Invalid escape sequences") {
 		ERR_PRINT_OFF
 		for (char32_t i = 0; i < 128; i++) {
@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<Vector2i> recorded_calls;
+
+static void record_call(int p_producer, int p_sequence) {
+	recorded_calls.push_back(Vector2i(p_producer, p_sequence));
+}
+
+TEST_CASE("[CallQueue] Calls are flushed in push order") {
+	CallQueue queue;
+	recorded_calls.clear();
+
+	// Enough calls to span several pages.
+	for (int i = 0; i < 1000; i++) {
+		queue.push_callable(callable_mp_static(&record_call), 0, i);
+	}
+	CHECK(queue.has_messages());
+
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	REQUIRE(recorded_calls.size() == 1000);
+	bool in_order = true;
+	for (uint32_t i = 0; i < recorded_calls.size(); i++) {
+		in_order = in_order && recorded_calls[i] == Vector2i(0, i);
+	}
+	CHECK(in_order);
+}
+
+static CallQueue *reentrant_queue = nullptr;
+
+static void push_again(int p_remaining) {
+	record_call(0, p_remaining);
+	if (p_remaining > 0) {
+		reentrant_queue->push_callable(callable_mp_static(&push_again), p_remaining - 1);
+	}
+}
+
+TEST_CASE("[CallQueue] Calls pushed while flushing are flushed too") {
+	CallQueue queue;
+	reentrant_queue = &queue;
+	recorded_calls.clear();
+
+	queue.push_callable(callable_mp_static(&push_again), 300);
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	REQUIRE(recorded_calls.size() == 301);
+	CHECK(recorded_calls[0] == Vector2i(0, 300));
+	CHECK(recorded_calls[300] == Vector2i(0, 0));
+
+	reentrant_queue = nullptr;
+}
+
+struct ProducerData {
+	CallQueue *queue = nullptr;
+	int producer = 0;
+	int count = 0;
+	SafeFlag *done = nullptr;
+};
+
+static void producer_thread(void *p_userdata) {
+	ProducerData *data = static_cast<ProducerData *>(p_userdata);
+	for (int i = 0; i < data->count; i++) {
+		data->queue->push_callable(callable_mp_static(&record_call), data->producer, i);
+	}
+	data->done->set();
+}
+
+TEST_CASE("[CallQueue] Calls pushed from several threads keep their per-thread order") {
+	const int producer_count = 4;
+	const int calls_per_producer = 5000;
+
+	CallQueue queue;
+	recorded_calls.clear();
+
+	ProducerData producers[producer_count];
+	SafeFlag done[producer_count];
+	Thread threads[producer_count];
+	for (int i = 0; i < producer_count; i++) {
+		producers[i].queue = &queue;
+		producers[i].producer = i;
+		producers[i].count = calls_per_producer;
+		producers[i].done = &done[i];
+		threads[i].start(producer_thread, &producers[i]);
+	}
+
+	// Flush concurrently with the producers, like the main loop does.
+	bool all_done = false;
+	while (!all_done) {
+		all_done = true;
+		for (int i = 0; i < producer_count; i++) {
+			all_done = all_done && done[i].is_set();
+		}
+		queue.flush();
+	}
+	for (int i = 0; i < producer_count; i++) {
+		threads[i].wait_to_finish();
+	}
+	queue.flush();
+
+	REQUIRE(recorded_calls.size() == producer_count * calls_per_producer);
+	int next_sequence[producer_count] = {};
+	bool in_order = true;
+	for (const Vector2i &call : recorded_calls) {
+		in_order = in_order && call.y == next_sequence[call.x];
+		next_sequence[call.x]++;
+	}
+	CHECK(in_order);
+}
+
+} // namespace TestMessageQueue
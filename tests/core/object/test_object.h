@@ -433,6 +433,29 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Emitting an existing signal without connections should succeed") {
+		Error err = object.emit_signal("my_custom_signal");
+		CHECK(err == OK);
+	}
+
+	SUBCASE("One-shot connections should be called once and then disconnected") {
+		Array empty_signal_args = { {} };
+		Object target;
+		Callable callable = callable_mp(&target, &Object::notify_property_list_changed);
+		object.connect("my_custom_signal", callable, Object::CONNECT_ONE_SHOT);
+
+		SIGNAL_WATCH(&target, "property_list_changed");
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		SIGNAL_CHECK("property_list_changed", empty_signal_args);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable));
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		SIGNAL_CHECK_FALSE("property_list_changed");
+
+		SIGNAL_UNWATCH(&target, "property_list_changed");
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
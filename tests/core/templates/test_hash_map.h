@@ -148,6 +148,36 @@ TEST_CASE("[HashMap] Const iteration") {
 	}
 }
 
+TEST_CASE("[HashMap] Copy") {
+	HashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i * 7 % 100, i);
+	}
+	map.erase(14);
+
+	HashMap<int, int> copy = map;
+	HashMap<int, int> assigned;
+	assigned.insert(-1, -1);
+	assigned = map;
+
+	CHECK_EQ(copy.size(), map.size());
+	CHECK_EQ(assigned.size(), map.size());
+	CHECK_FALSE(assigned.has(-1));
+	CHECK_FALSE(copy.has(14));
+
+	HashMap<int, int>::ConstIterator copy_it = copy.begin();
+	HashMap<int, int>::ConstIterator assigned_it = assigned.begin();
+	for (const KeyValue<int, int> &E : map) {
+		CHECK_EQ(copy_it->key, E.key);
+		CHECK_EQ(copy_it->value, E.value);
+		CHECK_EQ(assigned_it->key, E.key);
+		CHECK_EQ(assigned_it->value, E.value);
+		CHECK_EQ(copy[E.key], E.value);
+		++copy_it;
+		++assigned_it;
+	}
+}
+
 TEST_CASE("[HashMap] Sort") {
 	HashMap<int, int> hashmap;
 	int shuffled_ints[]{ 6, 1, 9, 8, 3, 0, 4, 5, 7, 2 };
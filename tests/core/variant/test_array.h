@@ -628,6 +628,30 @@ TEST_CASE("[Array] Typed copying") {
 	a6.clear();
 }
 
+TEST_CASE("[Array] Conversion to packed arrays") {
+	Array untyped = { 1, 2.5, "3" };
+	PackedFloat64Array from_untyped = Variant(untyped);
+	REQUIRE_EQ(from_untyped.size(), 3);
+	CHECK_EQ(from_untyped[0], 1.0);
+	CHECK_EQ(from_untyped[1], 2.5);
+	CHECK_EQ(from_untyped[2], 3.0);
+
+	TypedArray<int> typed_ints = { 4, -5, 6 };
+	PackedInt32Array from_typed_ints = Variant(typed_ints);
+	REQUIRE_EQ(from_typed_ints.size(), 3);
+	CHECK_EQ(from_typed_ints[0], 4);
+	CHECK_EQ(from_typed_ints[1], -5);
+	CHECK_EQ(from_typed_ints[2], 6);
+
+	TypedArray<Vector3> typed_vectors = { Vector3(1, 2, 3), Vector3(4, 5, 6) };
+	PackedVector3Array from_typed_vectors = Variant(typed_vectors);
+	REQUIRE_EQ(from_typed_vectors.size(), 2);
+	CHECK_EQ(from_typed_vectors[0], Vector3(1, 2, 3));
+	CHECK_EQ(from_typed_vectors[1], Vector3(4, 5, 6));
+
+	CHECK(PackedStringArray(Variant(Array())).is_empty());
+}
+
 static bool _find_custom_callable(const Variant &p_val) {
 	return (int)p_val % 2 == 0;
 }
@@ -541,6 +541,25 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] String and StringName keys") {
+	Dictionary d;
+	d[StringName("health")] = 100;
+	d[StringName("mana")] = 50;
+	d["stamina"] = 25;
+
+	CHECK_EQ(d[StringName("health")], Variant(100));
+	CHECK_EQ(d["health"], Variant(100));
+	CHECK_EQ(d[StringName("stamina")], Variant(25));
+	CHECK(d.has(StringName("mana")));
+	CHECK_FALSE(d.has(StringName("speed")));
+
+	Dictionary copy = d.duplicate();
+	copy[StringName("mana")] = 75;
+	CHECK_EQ(copy.keys(), d.keys());
+	CHECK_EQ(copy["mana"], Variant(75));
+	CHECK_EQ(d["mana"], Variant(50));
+}
+
 TEST_CASE("[Dictionary] Typed copying") {
 	TypedDictionary<int, int> d1;
 	d1[0] = 1;
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*  test_editor_import_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "editor/file_system/editor_import_cache.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEditorImportCache {
+
+class ImportCacheTestImporter : public ResourceImporter {
+public:
+	bool self_contained = true;
+	String settings;
+
+	virtual String get_importer_name() const override { return "import_cache_test"; }
+	virtual String get_visible_name() const override { return "Import Cache Test"; }
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override { p_extensions->push_back("txt"); }
+	virtual String get_save_extension() const override { return "res"; }
+	virtual String get_resource_type() const override { return "Resource"; }
+	virtual void get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset = 0) const override {
+		r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "quality"), 1));
+	}
+	virtual bool get_option_visibility(const String &p_path, const String &p_option, const HashMap<StringName, Variant> &p_options) const override { return true; }
+	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override { return OK; }
+	virtual bool is_import_self_contained() const override { return self_contained; }
+	virtual String get_import_cache_settings_string(const HashMap<StringName, Variant> &p_options) const override { return settings; }
+};
+
+static String _setup_test_dir() {
+	const String root = TestUtils::get_temp_path("editor_import_cache");
+	Ref<DirAccess> da = DirAccess::open(root);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+	DirAccess::make_dir_recursive_absolute(root.path_join("imported"));
+	return root;
+}
+
+static void _write_file(const String &p_path, const String &p_text) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_text);
+}
+
+static String _get_entry_path(const String &p_root, const Ref<ResourceImporter> &p_importer, int p_quality = 1) {
+	List<ResourceImporter::ImportOption> options;
+	p_importer->get_import_options(String(), &options);
+	HashMap<StringName, Variant> params;
+	params["quality"] = p_quality;
+	return EditorImportCache::get_entry_path(p_root.path_join("cache"), p_root.path_join("source.txt"), ResourceUID::INVALID_ID, p_importer, options, params, Variant());
+}
+
+TEST_CASE("[EditorImportCache] Stored imports are restored on a hit") {
+	const String root = _setup_test_dir();
+	const String base_path = root.path_join("imported/source.txt-0123");
+	Ref<ImportCacheTestImporter> importer;
+	importer.instantiate();
+
+	_write_file(root.path_join("source.txt"), "source");
+	_write_file(base_path + ".res", "imported");
+
+	const String entry = _get_entry_path(root, importer);
+	REQUIRE_FALSE(entry.is_empty());
+	List<String> variants;
+	Variant metadata;
+	CHECK_FALSE_MESSAGE(EditorImportCache::load_entry(entry, base_path, variants, metadata), "Nothing is cached yet.");
+
+	Dictionary stored_metadata;
+	stored_metadata["has_alpha"] = true;
+	CHECK(EditorImportCache::save_entry(entry, base_path, 0, List<String>(), stored_metadata) == OK);
+	CHECK(DirAccess::dir_exists_absolute(entry));
+	CHECK_MESSAGE(DirAccess::get_directories_at(entry.get_base_dir()).size() == 1, "The temporary entry should be renamed into place.");
+
+	DirAccess::remove_absolute(base_path + ".res");
+	CHECK(EditorImportCache::load_entry(entry, base_path, variants, metadata));
+	CHECK(FileAccess::get_file_as_string(base_path + ".res") == "imported");
+	CHECK(variants.is_empty());
+	CHECK(Dictionary(metadata) == stored_metadata);
+
+	// Storing the same entry again keeps the existing one.
+	CHECK(EditorImportCache::save_entry(entry, base_path, 0, List<String>(), stored_metadata) == OK);
+	CHECK(DirAccess::get_directories_at(entry.get_base_dir()).size() == 1);
+}
+
+TEST_CASE("[EditorImportCache] Changed inputs miss the cache") {
+	const String root = _setup_test_dir();
+	const String base_path = root.path_join("imported/source.txt-0123");
+	Ref<ImportCacheTestImporter> importer;
+	importer.instantiate();
+
+	_write_file(root.path_join("source.txt"), "source");
+	_write_file(base_path + ".res", "imported");
+	const String entry = _get_entry_path(root, importer);
+	REQUIRE(EditorImportCache::save_entry(entry, base_path, 0, List<String>(), Variant()) == OK);
+
+	CHECK_MESSAGE(_get_entry_path(root, importer, 2) != entry, "Import options are part of the key.");
+
+	importer->settings = "force_png=true";
+	CHECK_MESSAGE(_get_entry_path(root, importer) != entry, "Settings read by the importer are part of the key.");
+	importer->settings = String();
+	CHECK(_get_entry_path(root, importer) == entry);
+
+	_write_file(root.path_join("source.txt"), "changed source");
+	const String changed_entry = _get_entry_path(root, importer);
+	CHECK(changed_entry != entry);
+	List<String> variants;
+	Variant metadata;
+	CHECK_FALSE(EditorImportCache::load_entry(changed_entry, base_path, variants, metadata));
+}
+
+TEST_CASE("[EditorImportCache] Side files and variants are restored") {
+	const String root = _setup_test_dir();
+	const String base_path = root.path_join("imported/source.txt-0123");
+	Ref<ImportCacheTestImporter> importer;
+	importer.instantiate();
+
+	_write_file(root.path_join("source.txt"), "source");
+	_write_file(base_path + ".s3tc.res", "s3tc");
+	_write_file(base_path + ".etc2.res", "etc2");
+	_write_file(base_path + ".editor.meta", "editor meta");
+	_write_file(base_path + ".md5", "md5");
+	_write_file(root.path_join("imported/other.txt-4567.res"), "other");
+
+	List<String> stored_variants;
+	stored_variants.push_back("s3tc");
+	stored_variants.push_back("etc2");
+	const String entry = _get_entry_path(root, importer);
+	REQUIRE(EditorImportCache::save_entry(entry, base_path, 0, stored_variants, Variant()) == OK);
+
+	Ref<DirAccess> da = DirAccess::open(root.path_join("imported"));
+	REQUIRE(da.is_valid());
+	da->erase_contents_recursive();
+
+	List<String> variants;
+	Variant metadata;
+	CHECK(EditorImportCache::load_entry(entry, base_path, variants, metadata));
+	CHECK(variants.size() == 2);
+	CHECK(FileAccess::get_file_as_string(base_path + ".s3tc.res") == "s3tc");
+	CHECK(FileAccess::get_file_as_string(base_path + ".etc2.res") == "etc2");
+	CHECK_MESSAGE(FileAccess::get_file_as_string(base_path + ".editor.meta") == "editor meta", "Files not reported as variants should be restored too.");
+	CHECK_FALSE_MESSAGE(FileAccess::exists(base_path + ".md5"), "The MD5 file is written by the editor, not the importer.");
+	CHECK_FALSE_MESSAGE(FileAccess::exists(root.path_join("imported/other.txt-4567.res")), "Files of other imports should not be stored.");
+}
+
+TEST_CASE("[EditorImportCache] Only self-contained importers are cached") {
+	const String root = _setup_test_dir();
+	Ref<ImportCacheTestImporter> importer;
+	importer.instantiate();
+	_write_file(root.path_join("source.txt"), "source");
+
+	CHECK_FALSE(_get_entry_path(root, importer).is_empty());
+	importer->self_contained = false;
+	CHECK(_get_entry_path(root, importer).is_empty());
+}
+
+} // namespace TestEditorImportCache
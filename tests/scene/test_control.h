@@ -34,6 +34,8 @@
 
 #include "scene/2d/node_2d.h"
 #include "scene/gui/control.h"
+#include "scene/gui/panel_container.h"
+#include "scene/resources/style_box_flat.h"
 
 #include "tests/test_macros.h"
 
@@ -1214,4 +1216,118 @@ TEST_CASE("[SceneTree][Control] Grow direction") {
 	memdelete(test_control);
 }
 
+TEST_CASE("[SceneTree][Control] Theme change resizes nested containers") {
+	PanelContainer *outer = memnew(PanelContainer);
+	PanelContainer *inner = memnew(PanelContainer);
+	Control *leaf = memnew(Control);
+	leaf->set_custom_minimum_size(Size2(10, 10));
+	inner->add_child(leaf);
+	outer->add_child(inner);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	SceneTree::get_singleton()->process(0);
+
+	Ref<StyleBoxFlat> panel;
+	panel.instantiate();
+	panel->set_content_margin_all(5);
+	Ref<Theme> theme;
+	theme.instantiate();
+	theme->set_stylebox("panel", "PanelContainer", panel);
+
+	// Sizes are updated once the theme has been propagated to the whole subtree.
+	outer->set_theme(theme);
+	CHECK_EQ(inner->get_combined_minimum_size(), Size2(20, 20));
+	CHECK_EQ(outer->get_combined_minimum_size(), Size2(30, 30));
+	CHECK_EQ(outer->get_size(), Size2(30, 30));
+
+	memdelete(outer);
+}
+
+class ThemeSizeRecorder : public PanelContainer {
+	GDCLASS(ThemeSizeRecorder, PanelContainer);
+
+protected:
+	void _notification(int p_what) {
+		switch (p_what) {
+			case NOTIFICATION_THEME_CHANGED: {
+				size_on_theme_changed = get_size();
+				if (nested_theme.is_valid() && nested_target && nested_target->get_theme() != nested_theme) {
+					// Starts a propagation while the outer one is still running.
+					nested_target->set_theme(nested_theme);
+				}
+			} break;
+			case NOTIFICATION_RESIZED: {
+				size_on_resized = get_size();
+			} break;
+		}
+	}
+
+public:
+	Size2 size_on_theme_changed;
+	Size2 size_on_resized;
+	Ref<Theme> nested_theme;
+	Control *nested_target = nullptr;
+};
+
+TEST_CASE("[SceneTree][Control] Size seen during theme propagation") {
+	ThemeSizeRecorder *recorder = memnew(ThemeSizeRecorder);
+	Control *leaf = memnew(Control);
+	leaf->set_custom_minimum_size(Size2(10, 10));
+	recorder->add_child(leaf);
+	SceneTree::get_singleton()->get_root()->add_child(recorder);
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(recorder->get_size(), Size2(10, 10));
+
+	Ref<StyleBoxFlat> panel;
+	panel.instantiate();
+	panel->set_content_margin_all(5);
+	Ref<Theme> theme;
+	theme.instantiate();
+	theme->set_stylebox("panel", "PanelContainer", panel);
+
+	recorder->set_theme(theme);
+	CHECK_MESSAGE(recorder->size_on_theme_changed == Size2(10, 10), "The size is updated after the subtree has been notified.");
+	CHECK_EQ(recorder->size_on_resized, Size2(20, 20));
+	CHECK_EQ(recorder->get_size(), Size2(20, 20));
+
+	memdelete(recorder);
+}
+
+TEST_CASE("[SceneTree][Control] Theme change started during theme propagation") {
+	PanelContainer *outer = memnew(PanelContainer);
+	ThemeSizeRecorder *middle = memnew(ThemeSizeRecorder);
+	PanelContainer *inner = memnew(PanelContainer);
+	Control *leaf = memnew(Control);
+	leaf->set_custom_minimum_size(Size2(10, 10));
+	inner->add_child(leaf);
+	middle->add_child(inner);
+	outer->add_child(middle);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	SceneTree::get_singleton()->process(0);
+
+	Ref<StyleBoxFlat> outer_panel;
+	outer_panel.instantiate();
+	outer_panel->set_content_margin_all(5);
+	Ref<Theme> outer_theme;
+	outer_theme.instantiate();
+	outer_theme->set_stylebox("panel", "PanelContainer", outer_panel);
+
+	Ref<StyleBoxFlat> inner_panel;
+	inner_panel.instantiate();
+	inner_panel->set_content_margin_all(10);
+	Ref<Theme> inner_theme;
+	inner_theme.instantiate();
+	inner_theme->set_stylebox("panel", "PanelContainer", inner_panel);
+	middle->nested_theme = inner_theme;
+	middle->nested_target = inner;
+
+	// Size updates queued by the nested propagation are applied when the outer one ends.
+	outer->set_theme(outer_theme);
+	CHECK(inner->get_theme() == inner_theme);
+	CHECK_EQ(inner->get_combined_minimum_size(), Size2(30, 30));
+	CHECK_EQ(middle->get_combined_minimum_size(), Size2(40, 40));
+	CHECK_EQ(outer->get_size(), Size2(50, 50));
+
+	memdelete(outer);
+}
+
 } // namespace TestControl
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  test_importer_mesh.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/resources/3d/importer_mesh.h"
+#include "scene/resources/surface_tool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestImporterMesh {
+
+// A bumpy grid, detailed enough for the simplifier to produce several LODs.
+static Array create_grid_arrays(int p_size, float p_height) {
+	PackedVector3Array vertices;
+	PackedVector3Array normals;
+	PackedInt32Array indices;
+	for (int y = 0; y <= p_size; y++) {
+		for (int x = 0; x <= p_size; x++) {
+			vertices.push_back(Vector3(x, Math::sin(x * 0.5f) * Math::cos(y * 0.5f) * p_height, y));
+			normals.push_back(Vector3(0, 1, 0));
+		}
+	}
+	for (int y = 0; y < p_size; y++) {
+		for (int x = 0; x < p_size; x++) {
+			const int i = y * (p_size + 1) + x;
+			indices.push_back(i);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 1);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 2);
+			indices.push_back(i + p_size + 1);
+		}
+	}
+
+	Array arrays;
+	arrays.resize(Mesh::ARRAY_MAX);
+	arrays[Mesh::ARRAY_VERTEX] = vertices;
+	arrays[Mesh::ARRAY_NORMAL] = normals;
+	arrays[Mesh::ARRAY_INDEX] = indices;
+	return arrays;
+}
+
+TEST_CASE("[ImporterMesh] LODs generated in parallel match single surface generation") {
+	if (!SurfaceTool::simplify_scale_func || !SurfaceTool::simplify_with_attrib_func) {
+		return; // Mesh simplification is disabled in this build.
+	}
+
+	// The first three surfaces share their arrays, like surfaces created from the same source do.
+	const int sizes[] = { 32, 32, 32, 24, 40 };
+	const float heights[] = { 2.0, 2.0, 2.0, 4.0, 1.0 };
+	const Array shared_arrays = create_grid_arrays(sizes[0], heights[0]);
+
+	Ref<ImporterMesh> mesh;
+	mesh.instantiate();
+	mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, shared_arrays);
+	mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, shared_arrays);
+	mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, shared_arrays.duplicate());
+	mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, create_grid_arrays(sizes[3], heights[3]));
+	mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, create_grid_arrays(sizes[4], heights[4]));
+	mesh->generate_lods(25, Array());
+	REQUIRE(mesh->get_surface_count() == 5);
+
+	for (int i = 0; i < 5; i++) {
+		Ref<ImporterMesh> single_mesh;
+		single_mesh.instantiate();
+		single_mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, create_grid_arrays(sizes[i], heights[i]));
+		single_mesh->generate_lods(25, Array());
+
+		const int lod_count = single_mesh->get_surface_lod_count(0);
+		CHECK_MESSAGE(lod_count > 0, "The grid should be simplified.");
+		REQUIRE(mesh->get_surface_lod_count(i) == lod_count);
+		for (int lod = 0; lod < lod_count; lod++) {
+			CHECK(mesh->get_surface_lod_indices(i, lod) == single_mesh->get_surface_lod_indices(0, lod));
+			CHECK(mesh->get_surface_lod_size(i, lod) == doctest::Approx(single_mesh->get_surface_lod_size(0, lod)));
+		}
+	}
+}
+
+} // namespace TestImporterMesh
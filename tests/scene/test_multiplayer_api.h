@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  test_multiplayer_api.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/marshalls.h"
+#include "scene/main/multiplayer_api.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMultiplayerAPI {
+
+static void check_roundtrip(const Variant &p_value, int p_expected_size) {
+	int len = 0;
+	CHECK(MultiplayerAPI::encode_and_compress_variant(p_value, nullptr, len, false) == OK);
+	CHECK_EQ(len, p_expected_size);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	CHECK(MultiplayerAPI::encode_and_compress_variant(p_value, buffer.ptrw(), len, false) == OK);
+
+	Variant decoded;
+	int decoded_len = 0;
+	CHECK(MultiplayerAPI::decode_and_decompress_variant(decoded, buffer.ptr(), buffer.size(), &decoded_len, false) == OK);
+	CHECK_EQ(decoded_len, len);
+	CHECK_EQ(decoded.get_type(), p_value.get_type());
+	CHECK_EQ(decoded, p_value);
+}
+
+TEST_CASE("[MultiplayerAPI] Variant compression") {
+	SUBCASE("Integers use the smallest fitting size") {
+		check_roundtrip(12, 2);
+		check_roundtrip(-1234, 3);
+		check_roundtrip(123456789, 5);
+		check_roundtrip(int64_t(1) << 40, 9);
+	}
+
+	SUBCASE("Floats are stored as 32-bit when lossless") {
+		check_roundtrip(0.5, 5);
+		check_roundtrip(0.1, 9);
+	}
+
+	SUBCASE("Vectors are stored as 32-bit components when lossless") {
+		check_roundtrip(Vector2(1.5, -2.25), 9);
+		check_roundtrip(Vector3(1.5, -2.25, 1024), 13);
+	}
+
+	SUBCASE("Other types fall back to regular encoding") {
+		check_roundtrip(true, 1);
+		check_roundtrip(Color(1, 0, 0.5), 20);
+	}
+
+	SUBCASE("Floats and vectors from older peers are still decoded") {
+		const Variant values[] = { 0.1, Vector2(1.5, -2.25), Vector3(1.5, -2.25, 1024) };
+		for (const Variant &value : values) {
+			int len = 0;
+			CHECK(encode_variant(value, nullptr, len, false) == OK);
+			Vector<uint8_t> buffer;
+			buffer.resize(len);
+			CHECK(encode_variant(value, buffer.ptrw(), len, false) == OK);
+
+			Variant decoded;
+			int decoded_len = 0;
+			CHECK(MultiplayerAPI::decode_and_decompress_variant(decoded, buffer.ptr(), buffer.size(), &decoded_len, false) == OK);
+			CHECK_EQ(decoded_len, len);
+			CHECK_EQ(decoded, value);
+		}
+	}
+
+	SUBCASE("Truncated data is rejected") {
+		Vector<uint8_t> buffer;
+		int len = 0;
+		MultiplayerAPI::encode_and_compress_variant(Vector3(1, 2, 3), nullptr, len, false);
+		buffer.resize(len);
+		MultiplayerAPI::encode_and_compress_variant(Vector3(1, 2, 3), buffer.ptrw(), len, false);
+
+		Variant decoded;
+		ERR_PRINT_OFF;
+		CHECK(MultiplayerAPI::decode_and_decompress_variant(decoded, buffer.ptr(), buffer.size() - 1, nullptr, false) == ERR_INVALID_DATA);
+		ERR_PRINT_ON;
+	}
+}
+
+} // namespace TestMultiplayerAPI
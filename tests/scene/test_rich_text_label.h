@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  test_rich_text_label.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/gui/rich_text_label.h"
+#include "scene/gui/scroll_bar.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRichTextLabel {
+
+struct LabelEdit {
+	enum Type {
+		APPEND,
+		REMOVE_PARAGRAPH,
+		SET_WIDTH,
+		CLEAR,
+	};
+
+	Type type = APPEND;
+	String text;
+	int value = 0;
+};
+
+static RichTextLabel *_create_label() {
+	RichTextLabel *label = memnew(RichTextLabel);
+	label->set_autowrap_mode(TextServer::AUTOWRAP_WORD_SMART);
+	SceneTree::get_singleton()->get_root()->add_child(label);
+	label->set_size(Size2(200, 100));
+	return label;
+}
+
+static void _apply_edit(RichTextLabel *p_label, const LabelEdit &p_edit) {
+	switch (p_edit.type) {
+		case LabelEdit::APPEND: {
+			p_label->append_text(p_edit.text);
+		} break;
+		case LabelEdit::REMOVE_PARAGRAPH: {
+			p_label->remove_paragraph(p_edit.value);
+		} break;
+		case LabelEdit::SET_WIDTH: {
+			p_label->set_size(Size2(p_edit.value, 100));
+		} break;
+		case LabelEdit::CLEAR: {
+			p_label->clear();
+		} break;
+	}
+}
+
+// Compares the line lookups of `p_label`, whose line caches were updated after every edit,
+// with a label that received the same edits and builds its caches only once.
+static void _check_matches_fresh_label(RichTextLabel *p_label, const Vector<LabelEdit> &p_edits) {
+	RichTextLabel *expected = _create_label();
+	for (const LabelEdit &edit : p_edits) {
+		_apply_edit(expected, edit);
+	}
+
+	CHECK(p_label->get_paragraph_count() == expected->get_paragraph_count());
+	const int line_count = expected->get_line_count();
+	REQUIRE(p_label->get_line_count() == line_count);
+	for (int i = 0; i < line_count; i++) {
+		CHECK(p_label->get_line_range(i) == expected->get_line_range(i));
+
+		p_label->scroll_to_line(i);
+		expected->scroll_to_line(i);
+		CHECK(p_label->get_v_scroll_bar()->get_value() == doctest::Approx(expected->get_v_scroll_bar()->get_value()));
+	}
+
+	const int char_count = expected->get_total_character_count();
+	CHECK(p_label->get_total_character_count() == char_count);
+	for (int i = 0; i <= char_count; i++) {
+		CHECK(p_label->get_character_line(i) == expected->get_character_line(i));
+		CHECK(p_label->get_character_paragraph(i) == expected->get_character_paragraph(i));
+	}
+
+	memdelete(expected);
+}
+
+static void _edit_and_check(RichTextLabel *p_label, Vector<LabelEdit> &r_edits, const LabelEdit &p_edit) {
+	r_edits.push_back(p_edit);
+	_apply_edit(p_label, p_edit);
+	_check_matches_fresh_label(p_label, r_edits);
+}
+
+static LabelEdit _append(const String &p_text) {
+	LabelEdit edit;
+	edit.type = LabelEdit::APPEND;
+	edit.text = p_text;
+	return edit;
+}
+
+static LabelEdit _edit(LabelEdit::Type p_type, int p_value = 0) {
+	LabelEdit edit;
+	edit.type = p_type;
+	edit.value = p_value;
+	return edit;
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Line lookups without wrapping") {
+	RichTextLabel *label = memnew(RichTextLabel);
+	label->set_autowrap_mode(TextServer::AUTOWRAP_OFF);
+	SceneTree::get_singleton()->get_root()->add_child(label);
+	label->set_size(Size2(400, 100));
+	label->append_text("one\ntwo\nthree");
+
+	// Every paragraph is a single line, each newline is one character.
+	CHECK(label->get_paragraph_count() == 3);
+	CHECK(label->get_line_count() == 3);
+	CHECK(label->get_line_range(0).x == 0);
+	CHECK(label->get_line_range(1).x == 4);
+	CHECK(label->get_line_range(2) == Vector2i(8, 13));
+	CHECK(label->get_character_line(0) == 0);
+	CHECK(label->get_character_line(5) == 1);
+	CHECK(label->get_character_line(12) == 2);
+	CHECK(label->get_character_paragraph(3) == 0);
+	CHECK(label->get_character_paragraph(4) == 1);
+	CHECK(label->get_character_paragraph(12) == 2);
+	CHECK(label->get_character_paragraph(13) == -1);
+
+	label->append_text("\nfour");
+	CHECK(label->get_line_count() == 4);
+	CHECK(label->get_line_range(3) == Vector2i(14, 18));
+	CHECK(label->get_character_line(15) == 3);
+
+	label->remove_paragraph(1);
+	CHECK(label->get_line_count() == 3);
+	CHECK(label->get_line_range(1).x == 4);
+	CHECK(label->get_character_paragraph(4) == 1);
+	CHECK(label->get_character_line(11) == 2);
+
+	label->clear();
+	label->append_text("five");
+	CHECK(label->get_line_count() == 1);
+	CHECK(label->get_line_range(0) == Vector2i(0, 4));
+	CHECK(label->get_character_line(2) == 0);
+
+	memdelete(label);
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Line lookups follow incremental edits") {
+	const String paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor.";
+	RichTextLabel *label = _create_label();
+	Vector<LabelEdit> edits;
+
+	_edit_and_check(label, edits, _append(paragraph + "\n" + paragraph + "\nShort line.\n" + paragraph));
+	CHECK_MESSAGE(label->get_line_count() > label->get_paragraph_count(), "Paragraphs should wrap to test multi-line lookups.");
+
+	SUBCASE("Appending text") {
+		_edit_and_check(label, edits, _append("\n" + paragraph));
+		_edit_and_check(label, edits, _append(" Continued on the same paragraph."));
+		_edit_and_check(label, edits, _append("\nA\nB\n" + paragraph));
+	}
+
+	SUBCASE("Removing paragraphs") {
+		_edit_and_check(label, edits, _edit(LabelEdit::REMOVE_PARAGRAPH, 1));
+		_edit_and_check(label, edits, _edit(LabelEdit::REMOVE_PARAGRAPH, label->get_paragraph_count() - 1));
+		_edit_and_check(label, edits, _append("\n" + paragraph));
+		_edit_and_check(label, edits, _edit(LabelEdit::REMOVE_PARAGRAPH, 0));
+	}
+
+	SUBCASE("Changing the width") {
+		_edit_and_check(label, edits, _edit(LabelEdit::SET_WIDTH, 120));
+		_edit_and_check(label, edits, _append("\n" + paragraph));
+		_edit_and_check(label, edits, _edit(LabelEdit::SET_WIDTH, 300));
+	}
+
+	SUBCASE("Clearing the label") {
+		_edit_and_check(label, edits, _edit(LabelEdit::CLEAR));
+		CHECK(label->get_paragraph_count() == 1);
+		_edit_and_check(label, edits, _append(paragraph + "\n" + paragraph));
+		_edit_and_check(label, edits, _edit(LabelEdit::REMOVE_PARAGRAPH, 1));
+	}
+
+	memdelete(label);
+}
+
+} // namespace TestRichTextLabel
@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  test_audio_stream.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/audio/audio_stream.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStream {
+
+// Plays a ramp where frame `n` has the value `n + 1`, followed by silence.
+class RampPlayback : public AudioStreamPlaybackResampled {
+public:
+	int length = 0;
+	int position = 0;
+
+	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override {
+		int mixed = 0;
+		for (; mixed < p_frames && position < length; mixed++, position++) {
+			p_buffer[mixed] = AudioFrame(position + 1, -(position + 1));
+		}
+		for (int i = mixed; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		return mixed;
+	}
+
+	virtual float get_stream_sampling_rate() override {
+		return AudioServer::get_singleton()->get_mix_rate();
+	}
+
+	void start(int p_length) {
+		length = p_length;
+		position = 0;
+		begin_resample();
+	}
+};
+
+TEST_CASE("[Audio][AudioStreamPlaybackResampled] Mixing at the stream rate") {
+	Ref<RampPlayback> playback;
+	playback.instantiate();
+	playback->start(300);
+
+	// The resampler keeps two frames of interpolation history, so the ramp starts at the third output frame.
+	AudioFrame buffer[100];
+	for (int block = 0; block < 2; block++) {
+		CHECK(playback->mix(buffer, 1.0, 100) == 100);
+		for (int i = 0; i < 100; i++) {
+			const int frame = block * 100 + i;
+			const float expected = frame < 2 ? 0 : frame - 1;
+			CHECK_MESSAGE(buffer[i].left == expected, vformat("Unexpected value at frame %d.", frame));
+			CHECK_MESSAGE(buffer[i].right == -expected, vformat("Unexpected value at frame %d.", frame));
+		}
+	}
+
+	// Reaching the end of the stream reports fewer mixed frames.
+	CHECK(playback->mix(buffer, 1.0, 100) < 100);
+}
+
+TEST_CASE("[Audio][AudioStreamPlaybackResampled] Mixing at half the stream rate") {
+	Ref<RampPlayback> playback;
+	playback.instantiate();
+	playback->start(300);
+
+	AudioFrame buffer[200];
+	CHECK(playback->mix(buffer, 0.5, 200) == 200);
+
+	// Cubic interpolation of a ramp is exact, so every other frame lands halfway between two source frames.
+	for (int i = 8; i < 200; i++) {
+		CHECK_MESSAGE(buffer[i].left == doctest::Approx(i * 0.5 - 1), vformat("Unexpected value at frame %d.", i));
+	}
+}
+
+} // namespace TestAudioStream